@@ -0,0 +1,122 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_BENCH_HPP_
+#define PROX_DIGITAL_BENCH_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// A minimal benchmark harness: benchmarks register a function running a given number of
+/// iterations, and the runner grows that number until a run takes long enough to time reliably.
+namespace bench {
+
+using function = std::function<void(std::uint64_t iterations)>;
+
+struct benchmark {
+    std::string name;
+    function fn;
+};
+
+inline std::vector<benchmark>& registry() {
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct registrar {
+    registrar(std::string name, function fn) { registry().push_back({ std::move(name), std::move(fn) }); }
+};
+
+/// Keeps the compiler from discarding `value` or the computation producing it
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+struct measurement {
+    std::uint64_t iterations;
+    double ns_per_op;
+};
+
+inline measurement measure(const function& fn, std::chrono::nanoseconds minTime) {
+    using clock = std::chrono::steady_clock;
+    std::uint64_t iterations = 1;
+    for (;;) {
+        const auto start = clock::now();
+        fn(iterations);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+        if (elapsed >= minTime || iterations >= (std::uint64_t{ 1 } << 40)) {
+            return { iterations, static_cast<double>(elapsed.count()) / static_cast<double>(iterations) };
+        }
+        // aim slightly past the minimum time, growing at most 100x per round
+        const double scale = elapsed.count() > 0 ? 1.4 * static_cast<double>(minTime.count()) /
+                                                       static_cast<double>(elapsed.count())
+                                                 : 100.0;
+        iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * (scale < 100.0 ? scale : 100.0)) + 1;
+    }
+}
+
+/// Splits `iterations` over `threads` threads running `work(iterationsPerThread)` and joins them
+template <typename TWork>
+void run_threads(unsigned threads, std::uint64_t iterations, TWork work) {
+    std::vector<std::thread> pool;
+    const std::uint64_t perThread = iterations / threads + 1;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.push_back(std::thread([&work, perThread] { work(perThread); }));
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+/// 1, 2, 4, ... up to and including the number of hardware threads
+inline std::vector<unsigned> thread_counts() {
+    const unsigned max = std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1;
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < max; n *= 2) {
+        counts.push_back(n);
+    }
+    counts.push_back(max);
+    return counts;
+}
+
+} // namespace bench
+
+#define PROX_BENCH_CONCAT_IMPL(a, b) a##b
+#define PROX_BENCH_CONCAT(a, b) PROX_BENCH_CONCAT_IMPL(a, b)
+
+/// Registers `fn` (callable with the iteration count) under `name`
+#define BENCHMARK(name, fn) static const ::bench::registrar PROX_BENCH_CONCAT(benchRegistrar, __LINE__)(name, fn)
+
+#endif // PROX_DIGITAL_BENCH_HPP_
@@ -0,0 +1,93 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/chunks.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+// One extent of a file split across workers, read by index from `partition` next to materializing every
+// extent into a vector first, as callers splitting by hand do.
+namespace {
+constexpr std::size_t kValues = 4096;
+constexpr std::size_t kWorkers = 16;
+
+const std::vector<digital::bytes>& totals() {
+    static const std::vector<digital::bytes> v = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::int64_t> value(1, std::int64_t{ 1 } << 40);
+        std::vector<digital::bytes> res;
+        for (std::size_t i = 0; i < kValues; ++i) {
+            res.emplace_back(value(rng));
+        }
+        return res;
+    }();
+    return v;
+}
+
+std::vector<digital::extent<digital::bytes>> split(digital::bytes total, std::size_t workers) {
+    const std::int64_t granules = (total.value() + 4'095) / 4'096;
+    const auto n = static_cast<std::int64_t>(workers);
+    std::vector<digital::extent<digital::bytes>> res;
+    std::int64_t offset = 0;
+    for (std::int64_t i = 0; i < n; ++i) {
+        const std::int64_t length = (granules / n + (i < granules % n ? 1 : 0)) * 4'096;
+        const std::int64_t end = std::min(offset + length, total.value());
+        res.push_back({ digital::bytes(offset), digital::bytes(end - offset) });
+        offset = end;
+    }
+    return res;
+}
+
+const bool registered = [] {
+    bench::registrar("chunks/partition/vector", [](std::uint64_t iterations) {
+        const auto& v = totals();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(split(v[i % kValues], kWorkers)[i % kWorkers]);
+        }
+    });
+    bench::registrar("chunks/partition/index", [](std::uint64_t iterations) {
+        const auto& v = totals();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(digital::partition(v[i % kValues], kWorkers, 4_KiB)[i % kWorkers]);
+        }
+    });
+    bench::registrar("chunks/chunks/index", [](std::uint64_t iterations) {
+        const auto& v = totals();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const auto range = digital::chunks(v[i % kValues], 64_MiB, 4_KiB);
+            bench::do_not_optimize(range[i % range.size()]);
+        }
+    });
+    return true;
+}();
+} // namespace
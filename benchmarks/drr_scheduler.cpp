@@ -0,0 +1,65 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/drr_scheduler.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+// Scheduling overhead per MiB pushed through the deficit round robin scheduler: one iteration
+// enqueues and dequeues a MiB worth of items spread over all flows, so ns/op is ns per MiB.
+namespace {
+void register_drr(std::size_t flowCount, digital::bytes itemSize) {
+    const std::string name = "drr_scheduler/per_MiB/flows:" + std::to_string(flowCount) +
+                             "/item:" + std::to_string(itemSize.value()) + "B";
+    bench::registrar(name, [flowCount, itemSize](std::uint64_t iterations) {
+        digital::drr_scheduler<std::uint64_t> scheduler(64_KiB);
+        for (std::size_t i = 0; i < flowCount; ++i) {
+            scheduler.add_flow(static_cast<unsigned>(i % 4 + 1));
+        }
+        const std::uint64_t itemsPerMiB = static_cast<std::uint64_t>(1_MiB / itemSize);
+        for (std::uint64_t it = 0; it < iterations; ++it) {
+            for (std::uint64_t i = 0; i < itemsPerMiB; ++i) {
+                scheduler.enqueue(i % flowCount, i, itemSize);
+            }
+            while (auto next = scheduler.dequeue()) {
+                bench::do_not_optimize(next->value);
+            }
+        }
+    });
+}
+
+const bool registered = [] {
+    for (const std::size_t flows : { std::size_t{ 1 }, std::size_t{ 16 }, std::size_t{ 256 } }) {
+        register_drr(flows, 4_KiB);
+        register_drr(flows, 64_KiB);
+    }
+    return true;
+}();
+} // namespace
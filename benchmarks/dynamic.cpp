@@ -0,0 +1,122 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/dynamic.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+
+// Sizes with a scale picked at runtime converted through `dynamic_unit` next to the `switch` over
+// the scale that callers write otherwise. The scales are random, so the switch mispredicts.
+namespace {
+constexpr std::size_t kValues = 4096;
+
+const std::vector<digital::dynamic_unit>& values() {
+    static const std::vector<digital::dynamic_unit> v = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::int64_t> value(0, 1'000'000);
+        std::uniform_int_distribution<int> scale(0, 12);
+        std::vector<digital::dynamic_unit> res;
+        for (std::size_t i = 0; i < kValues; ++i) {
+            // keep exa and exbi counts small enough to fit in bytes
+            const auto s = static_cast<digital::dynamic_scale>(scale(rng));
+            const bool huge = s == digital::dynamic_scale::EB || s == digital::dynamic_scale::EiB;
+            res.emplace_back(huge ? value(rng) % 8 : value(rng), s);
+        }
+        return res;
+    }();
+    return v;
+}
+
+template <typename TTo>
+TTo switch_cast(const digital::dynamic_unit& d) {
+    switch (d.scale()) {
+    case digital::dynamic_scale::B:
+        return digital::unit_cast<TTo>(digital::bytes(d.value()));
+    case digital::dynamic_scale::KB:
+        return digital::unit_cast<TTo>(digital::kilobytes(d.value()));
+    case digital::dynamic_scale::MB:
+        return digital::unit_cast<TTo>(digital::megabytes(d.value()));
+    case digital::dynamic_scale::GB:
+        return digital::unit_cast<TTo>(digital::gigabytes(d.value()));
+    case digital::dynamic_scale::TB:
+        return digital::unit_cast<TTo>(digital::terabytes(d.value()));
+    case digital::dynamic_scale::PB:
+        return digital::unit_cast<TTo>(digital::petabytes(d.value()));
+    case digital::dynamic_scale::EB:
+        return digital::unit_cast<TTo>(digital::exabytes(d.value()));
+    case digital::dynamic_scale::KiB:
+        return digital::unit_cast<TTo>(digital::kibibytes(d.value()));
+    case digital::dynamic_scale::MiB:
+        return digital::unit_cast<TTo>(digital::mebibytes(d.value()));
+    case digital::dynamic_scale::GiB:
+        return digital::unit_cast<TTo>(digital::gibibytes(d.value()));
+    case digital::dynamic_scale::TiB:
+        return digital::unit_cast<TTo>(digital::tebibytes(d.value()));
+    case digital::dynamic_scale::PiB:
+        return digital::unit_cast<TTo>(digital::pebibytes(d.value()));
+    case digital::dynamic_scale::EiB:
+        return digital::unit_cast<TTo>(digital::exbibytes(d.value()));
+    default:
+        break;
+    }
+    return TTo{};
+}
+
+template <typename TTo>
+void register_target(const std::string& name) {
+    bench::registrar("dynamic/" + name + "/switch", [](std::uint64_t iterations) {
+        const auto& v = values();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(switch_cast<TTo>(v[i % kValues]));
+        }
+    });
+    bench::registrar("dynamic/" + name + "/table", [](std::uint64_t iterations) {
+        const auto& v = values();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(static_cast<TTo>(v[i % kValues]));
+        }
+    });
+}
+
+const bool registered = [] {
+    register_target<digital::bytes>("to_bytes");
+    register_target<digital::kibibytes>("to_kibibytes");
+    register_target<digital::megabytes>("to_megabytes");
+
+    bench::registrar("dynamic/compare", [](std::uint64_t iterations) {
+        const auto& v = values();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(v[i % kValues] < v[(i + 1) % kValues]);
+        }
+    });
+    return true;
+}();
+} // namespace
@@ -0,0 +1,85 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/fixed.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+// Fractional sizes through `long double` reps (x87 on x86-64) next to the same computation on
+// `fixed<std::int64_t, 16>`: converting byte counts to fractional GiB and pricing them per GiB.
+namespace {
+constexpr std::size_t kValues = 4096;
+
+using fx = digital::fixed<std::int64_t, 16>;
+
+const std::vector<digital::bytes>& sizes() {
+    static const std::vector<digital::bytes> values = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::int64_t> dist(0, std::int64_t{ 1 } << 40);
+        std::vector<digital::bytes> v;
+        for (std::size_t i = 0; i < kValues; ++i) {
+            v.emplace_back(dist(rng));
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <typename TRep>
+void register_rep(const char* name, TRep price) {
+    using TGibibytes = digital::unit<TRep, digital::gibi>;
+    const std::string suffix = std::string("/") + name;
+
+    bench::registrar("fixed/to_gibibytes" + suffix, [](std::uint64_t iterations) {
+        const auto& values = sizes();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(digital::unit_cast<TGibibytes>(values[i % kValues]));
+        }
+    });
+
+    bench::registrar("fixed/price" + suffix, [price](std::uint64_t iterations) {
+        const auto& values = sizes();
+        TRep total = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            total += digital::unit_cast<TGibibytes>(values[i % kValues]).value() * price;
+        }
+        bench::do_not_optimize(total);
+    });
+}
+
+const bool registered = [] {
+    register_rep<long double>("long_double", 0.023L);
+#if defined(__SIZEOF_INT128__)
+    register_rep<fx>("fixed", fx(0.023));
+#endif
+    return true;
+}();
+} // namespace
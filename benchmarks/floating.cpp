@@ -0,0 +1,100 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital.hpp>
+#include <prox/digital/bulk.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+
+// Fractional sizes as `unit_literals` produce them (`long double`, x87 on x86-64) next to the
+// `double_literals` ones: scaling fractional GiB and truncating them to whole bytes, element by
+// element and through the bulk `unit_cast`.
+namespace {
+constexpr std::size_t kValues = 4096;
+
+template <typename TRep>
+const std::vector<digital::unit<TRep, digital::gibi>>& gibibytes() {
+    static const std::vector<digital::unit<TRep, digital::gibi>> values = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_real_distribution<double> dist(0.0, 1024.0);
+        std::vector<digital::unit<TRep, digital::gibi>> v;
+        for (std::size_t i = 0; i < kValues; ++i) {
+            v.emplace_back(static_cast<TRep>(dist(rng)));
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <typename TRep>
+void register_rep(const std::string& name) {
+    bench::registrar("floating/to_bytes/" + name, [](std::uint64_t iterations) {
+        const auto& values = gibibytes<TRep>();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(digital::unit_cast<digital::bytes>(values[i % kValues]));
+        }
+    });
+
+    bench::registrar("floating/scale/" + name, [](std::uint64_t iterations) {
+        const auto& values = gibibytes<TRep>();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(digital::unit_cast<digital::bytes>(values[i % kValues] * TRep(0.75)));
+        }
+    });
+
+    // one iteration converts the whole vector; report per element by dividing by kValues
+    bench::registrar("floating/to_bytes_array/" + name, [](std::uint64_t iterations) {
+        const auto& values = gibibytes<TRep>();
+        std::vector<digital::bytes> out(kValues);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            for (std::size_t j = 0; j < kValues; ++j) {
+                out[j] = digital::unit_cast<digital::bytes>(values[j]);
+            }
+            bench::do_not_optimize(out.data());
+        }
+    });
+}
+
+const bool registered = [] {
+    register_rep<long double>("long_double");
+    register_rep<double>("double");
+
+    bench::registrar("floating/to_bytes_array/double_bulk", [](std::uint64_t iterations) {
+        const auto& values = gibibytes<double>();
+        std::vector<digital::bytes> out(kValues);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            digital::unit_cast<digital::bytes>(values.data(), values.data() + values.size(), out.data());
+            bench::do_not_optimize(out.data());
+        }
+    });
+    return true;
+}();
+} // namespace
@@ -0,0 +1,84 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/granular.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+
+// Byte counts converted to granules of a size only known at runtime, next to the plain division by the
+// same opaque size that callers write otherwise. One power-of-two and one arbitrary granule size.
+namespace {
+constexpr std::size_t kValues = 4096;
+
+struct bench_granularity {
+    static constexpr std::uint64_t default_bytes = 4'096;
+};
+
+using granules = digital::granular_unit<bench_granularity>;
+
+const std::vector<digital::bytes>& values() {
+    static const std::vector<digital::bytes> v = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::int64_t> value(0, std::int64_t{ 1 } << 40);
+        std::vector<digital::bytes> res;
+        for (std::size_t i = 0; i < kValues; ++i) {
+            res.emplace_back(value(rng));
+        }
+        return res;
+    }();
+    return v;
+}
+
+void register_granule(const std::string& name, std::int64_t size) {
+    bench::registrar("granular/" + name + "/division", [size](std::uint64_t iterations) {
+        const auto& v = values();
+        std::int64_t granule = size;
+        bench::do_not_optimize(granule);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const std::int64_t n = v[i % kValues].value();
+            bench::do_not_optimize((n + granule - 1) / granule);
+        }
+    });
+    bench::registrar("granular/" + name + "/ceil", [size](std::uint64_t iterations) {
+        granules::set_granularity(digital::bytes(size));
+        const auto& v = values();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(digital::ceil<granules>(v[i % kValues]));
+        }
+    });
+}
+
+const bool registered = [] {
+    register_granule("4096", 4'096);
+    register_granule("520", 520);
+    return true;
+}();
+} // namespace
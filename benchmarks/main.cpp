@@ -0,0 +1,124 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+void usage(const char* argv0) {
+    std::printf("usage: %s [--filter <substring>] [--min-time <ms>] [--json <file>|-]\n", argv0);
+}
+
+struct result {
+    const bench::benchmark* benchmark;
+    bench::measurement measurement;
+};
+
+std::string escape(const std::string& s) {
+    std::string out;
+    for (const char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+/// Writes the results in a format close to Google Benchmark's, so existing tooling can compare runs
+void write_json(std::FILE* out, const std::vector<result>& results, std::chrono::milliseconds minTime) {
+    std::fprintf(out, "{\n  \"context\": {\n");
+    std::fprintf(out, "    \"min_time_ms\": %lld,\n", static_cast<long long>(minTime.count()));
+    std::fprintf(out, "    \"num_cpus\": %u\n", bench::thread_counts().back());
+    std::fprintf(out, "  },\n  \"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::fprintf(
+            out,
+            "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"real_time\": %.3f, \"time_unit\": \"ns\"}",
+            i == 0 ? "" : ",",
+            escape(r.benchmark->name).c_str(),
+            static_cast<unsigned long long>(r.measurement.iterations),
+            r.measurement.ns_per_op
+        );
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter;
+    std::string json;
+    std::chrono::milliseconds minTime(200);
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minTime = std::chrono::milliseconds(std::strtol(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json = argv[++i];
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // with JSON on stdout the table goes to stderr to keep stdout parseable
+    std::FILE* table = json == "-" ? stderr : stdout;
+    std::vector<result> results;
+    std::fprintf(table, "%-56s %14s %12s\n", "benchmark", "iterations", "ns/op");
+    for (const auto& b : bench::registry()) {
+        if (!filter.empty() && b.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        const auto m = bench::measure(b.fn, minTime);
+        results.push_back({ &b, m });
+        std::fprintf(
+            table,
+            "%-56s %14llu %12.3f\n",
+            b.name.c_str(),
+            static_cast<unsigned long long>(m.iterations),
+            m.ns_per_op
+        );
+    }
+
+    if (!json.empty()) {
+        std::FILE* out = json == "-" ? stdout : std::fopen(json.c_str(), "w");
+        if (out == nullptr) {
+            std::fprintf(stderr, "cannot open %s\n", json.c_str());
+            return EXIT_FAILURE;
+        }
+        write_json(out, results, minTime);
+        if (out != stdout) {
+            std::fclose(out);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital.hpp>
+#include <prox/digital/align.hpp>
+#include <prox/digital/bulk.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+
+// Every public unit operation next to the same computation on raw int64_t. Each pair should
+// report the same ns/op; a gap is an abstraction cost worth investigating.
+namespace {
+constexpr std::size_t kValues = 4096;
+
+const std::vector<std::int64_t>& raw_values() {
+    static const std::vector<std::int64_t> values = [] {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::int64_t> dist(0, std::int64_t{ 1 } << 40);
+        std::vector<std::int64_t> v(kValues);
+        for (auto& x : v) {
+            x = dist(rng);
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <typename TUnit>
+const std::vector<TUnit>& unit_values() {
+    static const std::vector<TUnit> values = [] {
+        std::vector<TUnit> v;
+        for (const auto x : raw_values()) {
+            v.push_back(TUnit(x));
+        }
+        return v;
+    }();
+    return values;
+}
+
+/// Applies `op` to consecutive pairs of values, one pair per iteration
+template <typename T, typename TOp>
+bench::function pairwise(const std::vector<T>& values, TOp op) {
+    return [&values, op](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::do_not_optimize(op(values[i % kValues], values[(i + 1) % kValues]));
+        }
+    };
+}
+
+template <typename TRawOp, typename TUnitOp>
+void compare(const std::string& name, TRawOp rawOp, TUnitOp unitOp) {
+    bench::registrar("ops/" + name + "/raw", pairwise(raw_values(), rawOp));
+    bench::registrar("ops/" + name + "/unit", pairwise(unit_values<digital::bytes>(), unitOp));
+}
+
+template <typename TFn>
+void bulk(const std::string& name, TFn fn) {
+    bench::registrar("bulk/" + name, [fn](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            fn();
+        }
+    });
+}
+
+std::int64_t raw_round_half_even(std::int64_t v, std::int64_t den) {
+    const std::int64_t q = v / den;
+    const std::int64_t r = v % den;
+    return 2 * r > den || (2 * r == den && (q & 1) != 0) ? q + 1 : q;
+}
+
+const bool registered = [] {
+    using digital::bytes;
+    using digital::kibibytes;
+    using digital::kilobytes;
+
+    compare("add", std::plus<>{}, std::plus<>{});
+    compare("multiply", [](std::int64_t a, std::int64_t) { return a * 3; }, [](bytes a, bytes) { return a * 3; });
+    compare("add_mixed_ratio",
+            [](std::int64_t a, std::int64_t b) { return a + b * 1024; },
+            [](bytes a, bytes b) { return a + kibibytes(b.value()); });
+    compare("unit_cast/to_finer",
+            [](std::int64_t a, std::int64_t) { return a * 1024; },
+            [](bytes a, bytes) { return digital::unit_cast<bytes>(kibibytes(a.value())); });
+    compare("unit_cast/to_coarser",
+            [](std::int64_t a, std::int64_t) { return a / 1024; },
+            [](bytes a, bytes) { return digital::unit_cast<kibibytes>(a); });
+    compare("unit_cast/non_harmonic",
+            [](std::int64_t a, std::int64_t) { return a * 125 / 128; },
+            [](bytes a, bytes) { return digital::unit_cast<kibibytes>(kilobytes(a.value())); });
+#if defined(__SIZEOF_INT128__)
+    // the raw side is the plain 128-bit expression, which divides through __divti3
+    compare("unit_cast/widening",
+            [](std::int64_t a, std::int64_t) { return digital::detail::int128_t{ a } * 128 / 125; },
+            [](bytes a, bytes) { return digital::unit_cast<digital::wide_kilobytes>(kibibytes(a.value())); });
+#endif
+    compare("compare/same_ratio", std::less<>{}, std::less<>{});
+    compare("compare/cross_ratio",
+            [](std::int64_t a, std::int64_t b) { return a * 1024 < b; },
+            [](bytes a, bytes b) { return kibibytes(a.value()) < b; });
+    compare("floor", [](std::int64_t a, std::int64_t) { return a / 1024; }, [](bytes a, bytes) {
+        return digital::floor<kibibytes>(a);
+    });
+    compare("ceil", [](std::int64_t a, std::int64_t) { return (a + 1023) / 1024; }, [](bytes a, bytes) {
+        return digital::ceil<kibibytes>(a);
+    });
+    compare("round",
+            [](std::int64_t a, std::int64_t) { return raw_round_half_even(a, 1024); },
+            [](bytes a, bytes) { return digital::round<kibibytes>(a); });
+    // the same page rounding as `ceil` and `floor`, through masks
+    compare("align_up",
+            [](std::int64_t a, std::int64_t) { return (a + 4'095) & ~std::int64_t{ 4'095 }; },
+            [](bytes a, bytes) { return digital::align_up(a, kibibytes(4)); });
+    compare("align_down",
+            [](std::int64_t a, std::int64_t) { return a & ~std::int64_t{ 4'095 }; },
+            [](bytes a, bytes) { return digital::align_down(a, kibibytes(4)); });
+    compare("hash",
+            [](std::int64_t a, std::int64_t) { return std::hash<std::int64_t>{}(a); },
+            [](bytes a, bytes) { return std::hash<bytes>{}(a); });
+
+    bulk("sum/raw", [] {
+        const auto& v = raw_values();
+        bench::do_not_optimize(std::accumulate(v.begin(), v.end(), std::int64_t{ 0 }));
+    });
+    bulk("sum/unit", [] {
+        const auto& v = unit_values<bytes>();
+        bench::do_not_optimize(std::accumulate(v.begin(), v.end(), bytes{ 0 }));
+    });
+    bulk("sum/unit_simd", [] {
+        const auto& v = unit_values<bytes>();
+        bench::do_not_optimize(digital::sum(v.data(), v.data() + v.size()).value);
+    });
+    // bytes to kilobytes, a division by 1000: per element, and through the multiply-high bulk kernels
+    bulk("unit_cast/raw", [] {
+        static std::vector<std::int64_t> out(kValues);
+        const auto& v = raw_values();
+        std::transform(v.begin(), v.end(), out.begin(), [](std::int64_t x) { return x / 1000; });
+        bench::do_not_optimize(out.data());
+    });
+    bulk("unit_cast/unit", [] {
+        static std::vector<kilobytes> out(kValues);
+        const auto& v = unit_values<bytes>();
+        std::transform(v.begin(), v.end(), out.begin(), [](bytes x) {
+            return digital::unit_cast<kilobytes>(x);
+        });
+        bench::do_not_optimize(out.data());
+    });
+    bulk("unit_cast/unit_simd", [] {
+        static std::vector<kilobytes> out(kValues);
+        const auto& v = unit_values<bytes>();
+        digital::unit_cast<kilobytes>(v.data(), v.data() + v.size(), out.data());
+        bench::do_not_optimize(out.data());
+    });
+    bulk("sort/raw", [] {
+        auto v = raw_values();
+        std::sort(v.begin(), v.end());
+        bench::do_not_optimize(v.front());
+    });
+    bulk("sort/unit", [] {
+        auto v = unit_values<bytes>();
+        std::sort(v.begin(), v.end());
+        bench::do_not_optimize(v.front());
+    });
+    bulk("unordered_map/raw", [] {
+        std::unordered_map<std::int64_t, int> map;
+        for (const auto x : raw_values()) {
+            ++map[x];
+        }
+        bench::do_not_optimize(map.size());
+    });
+    bulk("unordered_map/unit", [] {
+        std::unordered_map<bytes, int> map;
+        for (const auto x : unit_values<bytes>()) {
+            ++map[x];
+        }
+        bench::do_not_optimize(map.size());
+    });
+    return true;
+}();
+} // namespace
@@ -0,0 +1,77 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/atomic.hpp>
+#include <prox/digital/sharded_counter.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+// Scaling of a hot byte counter from one thread up to every hardware thread: a plain
+// std::atomic, atomic_unit (which also tracks the peak) and sharded_counter. ns/op is wall time
+// per update across all threads, so a perfectly scaling counter shrinks with the thread count.
+namespace {
+const bool registered = [] {
+    for (const unsigned threads : bench::thread_counts()) {
+        const std::string suffix = "/threads:" + std::to_string(threads);
+
+        bench::registrar("counter/std::atomic<int64_t>" + suffix, [threads](std::uint64_t iterations) {
+            std::atomic<std::int64_t> counter{ 0 };
+            bench::run_threads(threads, iterations, [&counter](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    counter.fetch_add(1024, std::memory_order_relaxed);
+                }
+            });
+            bench::do_not_optimize(counter.load());
+        });
+
+        bench::registrar("counter/atomic_unit" + suffix, [threads](std::uint64_t iterations) {
+            digital::atomic_bytes counter;
+            bench::run_threads(threads, iterations, [&counter](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    counter.fetch_add(1_KiB, std::memory_order_relaxed);
+                }
+            });
+            bench::do_not_optimize(counter.load());
+        });
+
+        bench::registrar("counter/sharded_counter" + suffix, [threads](std::uint64_t iterations) {
+            digital::sharded_counter<digital::bytes> counter;
+            bench::run_threads(threads, iterations, [&counter](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    counter.add(1_KiB);
+                }
+            });
+            bench::do_not_optimize(counter.read());
+        });
+    }
+    return true;
+}();
+} // namespace
@@ -0,0 +1,73 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include "bench.hpp"
+
+#include <prox/digital/token_bucket.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+using namespace std::chrono_literals;
+
+// Throughput of the lock-free token bucket from one thread up to every hardware thread, once with
+// a limit that is never reached (the CAS fast path) and once saturated, where most calls fail.
+namespace {
+const bool registered = [] {
+    for (const unsigned threads : bench::thread_counts()) {
+        const std::string suffix = "/threads:" + std::to_string(threads);
+
+        bench::registrar("token_bucket/try_consume/unlimited" + suffix, [threads](std::uint64_t iterations) {
+            digital::token_bucket<> bucket(1_EiB, 1_EiB / 1s);
+            bench::run_threads(threads, iterations, [&bucket](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    bench::do_not_optimize(bucket.try_consume(4_KiB));
+                }
+            });
+        });
+
+        bench::registrar("token_bucket/try_consume/saturated" + suffix, [threads](std::uint64_t iterations) {
+            digital::token_bucket<> bucket(1_MiB, 100_MiB / 1s);
+            bench::run_threads(threads, iterations, [&bucket](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    bench::do_not_optimize(bucket.try_consume(4_KiB));
+                }
+            });
+        });
+
+        bench::registrar("token_bucket/reserve" + suffix, [threads](std::uint64_t iterations) {
+            digital::token_bucket<> bucket(1_EiB, 1_EiB / 1s);
+            bench::run_threads(threads, iterations, [&bucket](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    bench::do_not_optimize(bucket.reserve(4_KiB));
+                }
+            });
+        });
+    }
+    return true;
+}();
+} // namespace
@@ -25,39 +25,39 @@ SOFTWARE.
 #ifndef PROX_DIGITAL_HPP_
 #define PROX_DIGITAL_HPP_
 
+#include <prox/digital_fwd.hpp>
+
 #include <cstdint>
 #include <limits>
 #include <ratio>
-
-#ifndef PROX_DIGITAL_NAMESPACE_NAME
-#define PROX_DIGITAL_NAMESPACE_NAME prox::digital
+#include <type_traits>
+
+// C++20 builds use concepts and `operator<=>` instead of the SFINAE overload set; define
+// PROX_DIGITAL_NO_CONCEPTS to keep the C++17 declarations.
+#if !defined(PROX_DIGITAL_NO_CONCEPTS) && defined(__cpp_concepts) && __cpp_concepts >= 201907L && \
+    defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+#define PROX_DIGITAL_HAS_CONCEPTS 1
+#include <compare>
+#include <concepts>
+#else
+#define PROX_DIGITAL_HAS_CONCEPTS 0
 #endif
 
-namespace PROX_DIGITAL_NAMESPACE_NAME {
+// Constrains a function template through its trailing return type, `-> PROX_DIGITAL_REQUIRES((cond), T)`:
+// a requires-clause with concepts and `std::enable_if_t` without, so both builds share one declaration.
+#if PROX_DIGITAL_HAS_CONCEPTS
+#define PROX_DIGITAL_REQUIRES(condition, ...) __VA_ARGS__ requires condition
+#else
+#define PROX_DIGITAL_REQUIRES(condition, ...) std::enable_if_t<condition, __VA_ARGS__>
+#endif
 
-template <typename TRep, typename TRatio = std::ratio<1>>
-class unit;
+namespace std {
+template <typename T>
+struct hash;
+} // namespace std
 
+namespace PROX_DIGITAL_NAMESPACE_NAME {
 namespace detail {
-
-    template <typename T, T TValue, std::size_t TExp>
-    struct pow;
-
-    template <typename T, T TValue>
-    struct pow<T, TValue, 1> {
-        static constexpr T value = TValue;
-    };
-
-    template <typename T, T TValue>
-    struct pow<T, TValue, 0> {
-        static constexpr T value = 1;
-    };
-
-    template <typename T, T TValue, std::size_t TExp>
-    struct pow {
-        static constexpr T value = TValue * pow<T, TValue, TExp - 1>::value;
-    };
-
     namespace aux {
         template <class T, template <class...> class TPrimary>
         struct is_specialization_of : std::false_type {};
@@ -69,166 +69,172 @@ namespace detail {
     template <class T, template <class...> class TPrimary>
     inline constexpr bool is_specialization_of_v = aux::is_specialization_of<T, TPrimary>::value;
 
-    // number literals parsing - inspired by GNU
+    // number literals parsing
     namespace literal {
         namespace aux {
-            namespace impl {
-                template <unsigned TBase, unsigned TVal>
-                struct digit : std::integral_constant<unsigned, TVal> {
-                    static_assert(TVal < TBase, "digit outside of base range");
-                    using valid = std::true_type;
-                };
-            } // namespace impl
-
-            template <unsigned TBase, char TDig>
-            struct digit;
-
-            template <unsigned TBase>
-            struct digit<TBase, '0'> : impl::digit<TBase, 0> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '1'> : impl::digit<TBase, 1> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '2'> : impl::digit<TBase, 2> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '3'> : impl::digit<TBase, 3> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '4'> : impl::digit<TBase, 4> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '5'> : impl::digit<TBase, 5> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '6'> : impl::digit<TBase, 6> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '7'> : impl::digit<TBase, 7> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '8'> : impl::digit<TBase, 8> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, '9'> : impl::digit<TBase, 9> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'a'> : impl::digit<TBase, 0xa> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'A'> : impl::digit<TBase, 0xa> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'b'> : impl::digit<TBase, 0xb> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'B'> : impl::digit<TBase, 0xb> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'c'> : impl::digit<TBase, 0xc> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'C'> : impl::digit<TBase, 0xc> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'd'> : impl::digit<TBase, 0xd> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'D'> : impl::digit<TBase, 0xd> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'e'> : impl::digit<TBase, 0xe> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'E'> : impl::digit<TBase, 0xe> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'f'> : impl::digit<TBase, 0xf> {};
-
-            template <unsigned TBase>
-            struct digit<TBase, 'F'> : impl::digit<TBase, 0xf> {};
-
-            // digit separator (1'000'000)
-            template <unsigned TBase>
-            struct digit<TBase, '\''> : std::integral_constant<unsigned, 0> {
-                using valid = std::false_type;
+            struct parsed_integer {
+                unsigned long long value;
+                bool valid;
+                bool overflow;
             };
 
-            template <unsigned TBase, char TDig>
-            inline constexpr bool is_valid_digit_v = digit<TBase, TDig>::valid::value;
-
-            template <unsigned long long TVal>
-            using ull_constant = std::integral_constant<unsigned long long, TVal>;
-
-            // https://en.wikipedia.org/wiki/Positional_notation
-            namespace impl {
-                template <unsigned TBase, char TDig, char... TDigs>
-                struct positional_notation {
-                    using next = typename positional_notation<TBase, TDigs...>::type;
-                    using type = ull_constant<next::value*(is_valid_digit_v<TBase, TDig> ? TBase : 1ULL)>;
-                };
-
-                template <unsigned TBase, char TDig>
-                struct positional_notation<TBase, TDig> {
-                    using type = ull_constant<is_valid_digit_v<TBase, TDig>>;
-                };
-            } // namespace impl
-
-            template <unsigned TBase, char... TDigs>
-            struct positional_notation : impl::positional_notation<TBase, TDigs...>::type {};
-
-            template <unsigned TBase>
-            struct positional_notation<TBase> : ull_constant<0> {};
-
-            namespace impl {
-                template <unsigned TBase, unsigned long long TPow, char TDig, char... TDigs>
-                struct number {
-                    static constexpr auto value = aux::digit<TBase, TDig>::value;
-                    using next = number<TBase, is_valid_digit_v<TBase, TDig> ? TPow / TBase : TPow, TDigs...>;
-                    using type = ull_constant<TPow * value + next::type::value>;
-                    static_assert(
-                        (type::value / TPow) == value,
-                        "Integer literal does not fit in unsigned long long"
-                    );
-                };
-
-                template <unsigned TBase, unsigned long long TPow, char TDig, char... TDigs>
-                struct number<TBase, TPow, '\'', TDig, TDigs...> : number<TBase, TPow, TDig, TDigs...> {};
-
-                template <unsigned TBase, char TDig>
-                struct number<TBase, 1ULL, TDig> {
-                    using type = ull_constant<aux::digit<TBase, TDig>::value>;
-                };
-            } // namespace impl
-
-            template <unsigned TBase, char... TDigs>
-            struct number : impl::number<TBase, positional_notation<TBase, TDigs...>::value, TDigs...>::type {
-            };
+            constexpr unsigned digit_value(char c) {
+                if (c >= '0' && c <= '9') {
+                    return static_cast<unsigned>(c - '0');
+                }
+                if (c >= 'a' && c <= 'f') {
+                    return static_cast<unsigned>(c - 'a' + 10);
+                }
+                if (c >= 'A' && c <= 'F') {
+                    return static_cast<unsigned>(c - 'A' + 10);
+                }
+                return 16U;
+            }
 
-            template <unsigned TBase>
-            struct number<TBase> : ull_constant<0> {};
+            /// Parses the characters of an integer literal (with `0x`, `0b` and `0` prefixes and `'`
+            /// separators) in a single constant evaluation instead of a template per digit
+            template <std::size_t TSize>
+            constexpr parsed_integer parse_integer(const char (&digits)[TSize]) {
+                std::size_t i = 0;
+                unsigned base = 10U;
+                if (TSize > 1 && digits[0] == '0') {
+                    if (digits[1] == 'x' || digits[1] == 'X') {
+                        base = 16U;
+                        i = 2;
+                    } else if (digits[1] == 'b' || digits[1] == 'B') {
+                        base = 2U;
+                        i = 2;
+                    } else {
+                        base = 8U;
+                        i = 1;
+                    }
+                }
 
-            template <char... TDigs>
-            struct int_parser;
+                parsed_integer result{ 0ULL, true, false };
+                for (; i < TSize; ++i) {
+                    if (digits[i] == '\'') {
+                        continue;
+                    }
+                    const unsigned digit = digit_value(digits[i]);
+                    if (digit >= base) {
+                        result.valid = false;
+                        break;
+                    }
+                    if (result.value > (std::numeric_limits<unsigned long long>::max() - digit) / base) {
+                        result.overflow = true;
+                    }
+                    result.value = result.value * base + digit;
+                }
+                return result;
+            }
 
-            template <char... TDigs>
-            struct int_parser<'0', 'b', TDigs...> : number<2U, TDigs...>::type {};
+            struct parsed_fraction {
+                unsigned long long value;
+                bool valid;
+                bool overflow;
+                bool whole;
+            };
 
-            template <char... TDigs>
-            struct int_parser<'0', 'B', TDigs...> : number<2U, TDigs...>::type {};
+            constexpr unsigned long long gcd(unsigned long long a, unsigned long long b) {
+                while (b != 0) {
+                    const unsigned long long r = a % b;
+                    a = b;
+                    b = r;
+                }
+                return a;
+            }
 
-            template <char... TDigs>
-            struct int_parser<'0', 'x', TDigs...> : number<16U, TDigs...>::type {};
+            /// Whether the characters form a floating literal rather than an integer literal
+            template <std::size_t TSize>
+            constexpr bool is_fractional(const char (&digits)[TSize]) {
+                const bool hex = TSize > 1 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X');
+                for (std::size_t i = 0; i < TSize; ++i) {
+                    const char c = digits[i];
+                    if (c == '.' || (hex ? c == 'p' || c == 'P' : c == 'e' || c == 'E')) {
+                        return true;
+                    }
+                }
+                return false;
+            }
 
-            template <char... TDigs>
-            struct int_parser<'0', 'X', TDigs...> : number<16U, TDigs...>::type {};
+            /// Evaluates a decimal floating literal (`1.5`, `2e3`, `0.000'001`) scaled by `num / den`
+            /// exactly, with `whole` cleared when the result is not an integer
+            template <std::size_t TSize>
+            constexpr parsed_fraction
+            parse_fraction(const char (&digits)[TSize], unsigned long long num, unsigned long long den) {
+                constexpr unsigned long long kMax = std::numeric_limits<unsigned long long>::max();
+                parsed_fraction result{ 0ULL, true, false, true };
+                if (TSize > 1 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+                    result.valid = false;
+                    return result;
+                }
 
-            template <char... TDigs>
-            struct int_parser<'0', TDigs...> : number<8U, TDigs...>::type {};
+                long long scale = 0;
+                bool point = false;
+                std::size_t i = 0;
+                for (; i < TSize && digits[i] != 'e' && digits[i] != 'E'; ++i) {
+                    if (digits[i] == '\'') {
+                        continue;
+                    }
+                    if (digits[i] == '.') {
+                        point = true;
+                        continue;
+                    }
+                    const unsigned digit = digit_value(digits[i]);
+                    if (digit >= 10U) {
+                        result.valid = false;
+                        return result;
+                    }
+                    if (result.value > (kMax - digit) / 10U) {
+                        result.overflow = true;
+                        return result;
+                    }
+                    result.value = result.value * 10U + digit;
+                    scale -= point ? 1 : 0;
+                }
+                if (i < TSize) {
+                    bool negative = false;
+                    long long exponent = 0;
+                    for (++i; i < TSize; ++i) {
+                        if (digits[i] == '-' || digits[i] == '+') {
+                            negative = digits[i] == '-';
+                        } else if (digits[i] != '\'' && exponent < 10'000) {
+                            exponent = exponent * 10 + static_cast<long long>(digit_value(digits[i]));
+                        }
+                    }
+                    scale += negative ? -exponent : exponent;
+                }
 
-            template <char... TDigs>
-            struct int_parser : number<10U, TDigs...>::type {};
+                // divide out the powers of ten from the digits and the ratio's numerator
+                for (; scale < 0 && result.value != 0; ++scale) {
+                    const unsigned long long fromValue = gcd(result.value, 10U);
+                    result.value /= fromValue;
+                    const unsigned long long rest = 10U / fromValue;
+                    if (num % rest != 0) {
+                        result.whole = false;
+                        return result;
+                    }
+                    num /= rest;
+                }
+                for (; scale > 0 && result.value != 0; --scale) {
+                    if (result.value > kMax / 10U) {
+                        result.overflow = true;
+                        return result;
+                    }
+                    result.value *= 10U;
+                }
+                if (result.value % den != 0) {
+                    result.whole = false;
+                    return result;
+                }
+                result.value /= den;
+                if (result.value != 0 && num > kMax / result.value) {
+                    result.overflow = true;
+                    return result;
+                }
+                result.value *= num;
+                return result;
+            }
 
             template <typename R, typename T>
             constexpr bool in_range(T value) noexcept {
@@ -245,14 +251,42 @@ namespace detail {
             }
         } // namespace aux
 
-        template <typename TUnit, char... TDigits, auto TValue = aux::int_parser<TDigits...>::value>
+        template <typename TUnit, char... TDigits>
         constexpr TUnit parse() {
             using UnitType = typename TUnit::rep;
             using aux::in_range;
+            constexpr char kDigits[] = { TDigits... };
+            constexpr aux::parsed_integer kParsed = aux::parse_integer(kDigits);
+            static_assert(kParsed.valid, "digit outside of base range");
+            static_assert(!kParsed.overflow, "Integer literal does not fit in unsigned long long");
             // clang-format off
-            static_assert(in_range<UnitType>(TValue), "This value is out of range of the unit's representation type");
+            static_assert(in_range<UnitType>(kParsed.value), "This value is out of range of the unit's representation type");
             // clang-format on
-            return TUnit(TValue);
+            return TUnit(kParsed.value);
+        }
+
+        /// Integer literals as `parse`; decimal floating literals evaluated exactly into the unit's
+        /// integral representation at a ratio of 1 (bytes)
+        template <typename TUnit, char... TDigits>
+        constexpr auto parse_exact() {
+            constexpr char kDigits[] = { TDigits... };
+            if constexpr (!aux::is_fractional(kDigits)) {
+                return parse<TUnit, TDigits...>();
+            } else {
+                using UnitType = typename TUnit::rep;
+                using TRatio = typename TUnit::ratio;
+                using aux::in_range;
+                constexpr auto kNum = static_cast<unsigned long long>(TRatio::num);
+                constexpr auto kDen = static_cast<unsigned long long>(TRatio::den);
+                constexpr aux::parsed_fraction kParsed = aux::parse_fraction(kDigits, kNum, kDen);
+                static_assert(kParsed.valid, "Only decimal floating literals can be evaluated exactly");
+                static_assert(!kParsed.overflow, "Floating literal does not fit in unsigned long long bytes");
+                static_assert(kParsed.whole, "Floating literal is not a whole number of bytes");
+                // clang-format off
+                static_assert(in_range<UnitType>(kParsed.value), "This value is out of range of the unit's representation type");
+                // clang-format on
+                return unit<UnitType>(static_cast<UnitType>(kParsed.value));
+            }
         }
     } // namespace literal
 
@@ -301,12 +335,220 @@ namespace detail {
     template <typename TRep1, typename TRep2, typename TCRep = std::common_type_t<TRep1, TRep2>>
     using common_rep = std::enable_if_t<std::is_convertible_v<const TRep2&, TCRep>, TCRep>;
 
+    /// Integral reps, including the 128-bit ones `std::is_integral` only reports in GNU modes
+    template <typename T>
+    inline constexpr bool is_integral_rep_v = std::numeric_limits<T>::is_integer;
+
+#if defined(__SIZEOF_INT128__)
+    using widest_unsigned = uint128_t;
+#else
+    using widest_unsigned = std::uintmax_t;
+#endif
+
+    /// Whether scaling some value of `TRep` by `TFactor` may exceed the range of `TCommonRep`
+    template <typename TRep, typename TCommonRep, std::intmax_t TFactor>
+    inline constexpr bool may_overflow_v =
+        is_integral_rep_v<TRep> && is_integral_rep_v<TCommonRep> && TFactor != 1 &&
+        static_cast<widest_unsigned>(std::numeric_limits<TRep>::max()) >=
+            static_cast<widest_unsigned>(std::numeric_limits<TCommonRep>::max()) /
+                static_cast<widest_unsigned>(TFactor);
+
+    /// Whether a conversion from `TFrom` to `TTo` goes from a 64-bit integral rep to a 128-bit one
+    template <typename TFrom, typename TTo>
+    inline constexpr bool is_widening_v =
+        is_integral_rep_v<TFrom> && is_integral_rep_v<TTo> && sizeof(TFrom) <= sizeof(std::int64_t) &&
+        sizeof(TTo) > sizeof(std::int64_t) &&
+        (std::numeric_limits<TFrom>::is_signed == std::numeric_limits<TTo>::is_signed ||
+         !std::numeric_limits<TFrom>::is_signed);
+
+    // 64x64 -> 128 bit arithmetic for the instantiations whose intermediates may not fit
+    namespace wide {
+#if defined(__SIZEOF_INT128__)
+        template <typename T>
+        struct int128 {
+            using type = std::conditional_t<std::numeric_limits<T>::is_signed, int128_t, uint128_t>;
+        };
+#endif
+
+        struct uint128 {
+            std::uint64_t hi;
+            std::uint64_t lo;
+        };
+
+        constexpr uint128 mul(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            const uint128_t p = static_cast<uint128_t>(a) * b;
+            return { static_cast<std::uint64_t>(p >> 64), static_cast<std::uint64_t>(p) };
+#else
+            constexpr std::uint64_t kMask = 0xffffffffULL;
+            const std::uint64_t ll = (a & kMask) * (b & kMask);
+            const std::uint64_t lh = (a & kMask) * (b >> 32);
+            const std::uint64_t hl = (a >> 32) * (b & kMask);
+            const std::uint64_t hh = (a >> 32) * (b >> 32);
+            const std::uint64_t mid = (ll >> 32) + (lh & kMask) + (hl & kMask);
+            return { hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & kMask) };
+#endif
+        }
+
+        /// Division by an invariant 64-bit divisor through a precomputed reciprocal (Möller and
+        /// Granlund, "Improved division by invariant integers"): two multiplications and no `div`
+        struct divider {
+            std::uint64_t normalized;
+            std::uint64_t reciprocal;
+            unsigned shift;
+        };
+
+        constexpr divider make_divider(std::uint64_t d) {
+            unsigned shift = 0;
+            while ((d << shift) >> 63 == 0) {
+                ++shift;
+            }
+            const std::uint64_t normalized = d << shift;
+            // floor((2^128 - 1) / normalized) - 2^64, i.e. (~normalized : ~0) / normalized
+            std::uint64_t rem = ~normalized;
+            std::uint64_t quot = 0;
+            for (int bit = 63; bit >= 0; --bit) {
+                const bool carry = (rem >> 63) != 0;
+                rem = (rem << 1) | 1U;
+                quot <<= 1;
+                if (carry || rem >= normalized) {
+                    rem -= normalized;
+                    quot |= 1U;
+                }
+            }
+            return { normalized, quot, shift };
+        }
+
+        /// `n / d`, valid when the quotient fits in 64 bits (`n.hi < d`)
+        constexpr std::uint64_t divide(uint128 n, const divider& d) {
+            const std::uint64_t u1 = (n.hi << d.shift) | ((n.lo >> 1) >> (63 - d.shift));
+            const std::uint64_t u0 = n.lo << d.shift;
+            const uint128 p = mul(d.reciprocal, u1);
+            const std::uint64_t q0 = p.lo + u0;
+            std::uint64_t q1 = p.hi + u1 + 1 + (q0 < u0 ? 1 : 0);
+            std::uint64_t r = u0 - q1 * d.normalized;
+            if (r > q0) {
+                --q1;
+                r += d.normalized;
+            }
+            if (r >= d.normalized) {
+                ++q1;
+            }
+            return q1;
+        }
+
+        /// A 64-bit result and whether it was representable
+        struct checked {
+            std::uint64_t value;
+            bool fits;
+        };
+
+        /// `n * num / den` truncated, for `d` made from `den`, without a 128-bit intermediate overflowing.
+        /// `fits` is false when the result needs more than 64 bits.
+        constexpr checked mul_div(uint128 n, std::uint64_t num, std::uint64_t den, const divider& d) {
+            const bool small = n.hi < den;
+            const std::uint64_t quot = divide({ small ? n.hi : n.hi % den, n.lo }, d);
+            const std::uint64_t rem = n.lo - quot * den;
+            const uint128 whole = mul(quot, num);
+            // rem < den, so the quotient of the remainder is below num
+            const std::uint64_t value = whole.lo + divide(mul(rem, num), d);
+            return { value, small && whole.hi == 0 && value >= whole.lo };
+        }
+
+#if defined(__SIZEOF_INT128__)
+        /// A 128-bit magnitude scaled by a 64-bit factor; `hi` holds the bits from 128 up
+        struct uint192 {
+            std::uint64_t hi;
+            uint128_t lo;
+        };
+
+        constexpr uint192 mul(uint128_t a, std::uint64_t b) {
+            const uint128_t lo = static_cast<uint128_t>(static_cast<std::uint64_t>(a)) * b;
+            const uint128_t hi = (a >> 64) * b + (lo >> 64);
+            return { static_cast<std::uint64_t>(hi >> 64), (hi << 64) | static_cast<std::uint64_t>(lo) };
+        }
+
+        constexpr bool less(const uint192& a, const uint192& b) {
+            return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+        }
+
+        /// Divides `n` by `d` in place, one 64-bit limb at a time, and returns the remainder
+        constexpr std::uint64_t divmod(uint192& n, std::uint64_t d) {
+            const std::uint64_t q2 = n.hi / d;
+            uint128_t cur = static_cast<uint128_t>(n.hi % d) << 64 | static_cast<std::uint64_t>(n.lo >> 64);
+            const auto q1 = static_cast<std::uint64_t>(cur / d);
+            cur = cur % d << 64 | static_cast<std::uint64_t>(n.lo);
+            const auto q0 = static_cast<std::uint64_t>(cur / d);
+            n = { q2, static_cast<uint128_t>(q1) << 64 | q0 };
+            return static_cast<std::uint64_t>(cur % d);
+        }
+
+        /// The magnitude of a 128-bit value, computed so that negating the minimum doesn't overflow
+        template <typename T>
+        constexpr uint128_t magnitude(T v, bool negative) {
+            const auto bits = static_cast<uint128_t>(v);
+            return negative ? uint128_t{ 0 } - bits : bits;
+        }
+#endif
+
+        /// Three-way comparison of `a * TFactorA` and `b * TFactorB` without overflowing
+        template <std::intmax_t TFactorA, std::intmax_t TFactorB, typename T>
+        constexpr int compare_scaled(T a, T b) {
+#if defined(__SIZEOF_INT128__)
+            if constexpr (sizeof(T) <= sizeof(std::int64_t)) {
+                using TWide = typename int128<T>::type;
+                const TWide lhs = static_cast<TWide>(a) * static_cast<TWide>(TFactorA);
+                const TWide rhs = static_cast<TWide>(b) * static_cast<TWide>(TFactorB);
+                return (lhs > rhs) - (lhs < rhs);
+            } else {
+                bool negA = false;
+                bool negB = false;
+                if constexpr (std::numeric_limits<T>::is_signed) {
+                    negA = a < 0;
+                    negB = b < 0;
+                }
+                if (negA != negB) {
+                    return negA ? -1 : 1;
+                }
+                const uint192 lhs = mul(magnitude(a, negA), static_cast<std::uint64_t>(TFactorA));
+                const uint192 rhs = mul(magnitude(b, negB), static_cast<std::uint64_t>(TFactorB));
+                const int res = less(rhs, lhs) - less(lhs, rhs);
+                return negA ? -res : res;
+            }
+#else
+            bool negA = false;
+            bool negB = false;
+            if constexpr (std::is_signed_v<T>) {
+                negA = a < 0;
+                negB = b < 0;
+            }
+            if (negA != negB) {
+                return negA ? -1 : 1;
+            }
+            // magnitudes, computed so that negating the minimum doesn't overflow
+            const auto magA = negA ? static_cast<std::uint64_t>(-(a + 1)) + 1 : static_cast<std::uint64_t>(a);
+            const auto magB = negB ? static_cast<std::uint64_t>(-(b + 1)) + 1 : static_cast<std::uint64_t>(b);
+            const uint128 lhs = mul(magA, static_cast<std::uint64_t>(TFactorA));
+            const uint128 rhs = mul(magB, static_cast<std::uint64_t>(TFactorB));
+            int res = 0;
+            if (lhs.hi != rhs.hi) {
+                res = lhs.hi < rhs.hi ? -1 : 1;
+            } else if (lhs.lo != rhs.lo) {
+                res = lhs.lo < rhs.lo ? -1 : 1;
+            }
+            return negA ? -res : res;
+#endif
+        }
+    } // namespace wide
+
     template <
         typename TTo,
         typename TDivide,
         typename TCommonRep,
         bool TNumIsOne = false,
-        bool TDenIsOne = false>
+        bool TDenIsOne = false,
+        bool TMayOverflow = false,
+        bool TWidening = false>
     struct unit_cast {
         template <typename TRep, typename TRatio>
         constexpr TTo operator()(const unit<TRep, TRatio>& from) const {
@@ -344,48 +586,114 @@ namespace detail {
             ));
         }
     };
+
+    // `value * num` may overflow even though the result fits, e.g. kilobytes -> kibibytes (125/128)
+    template <typename TTo, typename TDivide, typename TCommonRep>
+    struct unit_cast<TTo, TDivide, TCommonRep, false, false, true> {
+        template <typename TRep, typename TRatio>
+        constexpr TTo operator()(const unit<TRep, TRatio>& from) const {
+            constexpr auto kNum = static_cast<TCommonRep>(TDivide::num);
+            constexpr auto kDen = static_cast<TCommonRep>(TDivide::den);
+            const auto value = static_cast<TCommonRep>(from.value());
+            if constexpr (kNum <= std::numeric_limits<TCommonRep>::max() / kDen) {
+                // split into quotient and remainder, neither of the products exceeds the result
+                return TTo(static_cast<typename TTo::rep>(value / kDen * kNum + value % kDen * kNum / kDen));
+            } else {
+#if defined(__SIZEOF_INT128__)
+                using TWide = typename wide::int128<TCommonRep>::type;
+                return TTo(static_cast<typename TTo::rep>(
+                    static_cast<TWide>(value) * static_cast<TWide>(kNum) / static_cast<TWide>(kDen)
+                ));
+#else
+                // scale the magnitude, dividing the 128-bit product through a reciprocal of den
+                constexpr auto kNum64 = static_cast<std::uint64_t>(kNum);
+                constexpr auto kDen64 = static_cast<std::uint64_t>(kDen);
+                constexpr wide::divider kDivider = wide::make_divider(kDen64);
+                using TUnsigned = std::make_unsigned_t<TCommonRep>;
+                bool negative = false;
+                if constexpr (std::is_signed_v<TCommonRep>) {
+                    negative = value < 0;
+                }
+                const auto bits = static_cast<TUnsigned>(value);
+                const std::uint64_t magnitude = negative ? static_cast<TUnsigned>(0U - bits) : bits;
+                const wide::checked product = wide::mul_div({ 0, magnitude }, kNum64, kDen64, kDivider);
+                const auto scaled = static_cast<TUnsigned>(product.value);
+                return TTo(static_cast<typename TTo::rep>(
+                    static_cast<TCommonRep>(negative ? static_cast<TUnsigned>(0U - scaled) : scaled)
+                ));
+#endif
+            }
+        }
+    };
+
+    // 64-bit source into a 128-bit rep: divide in 64 bits and widen only for the multiply, sparing the
+    // 128-bit division `value * num / den` would take
+    template <typename TTo, typename TDivide, typename TCommonRep>
+    struct unit_cast<TTo, TDivide, TCommonRep, false, false, false, true> {
+        template <typename TRep, typename TRatio>
+        constexpr TTo operator()(const unit<TRep, TRatio>& from) const {
+            using TNarrow =
+                std::conditional_t<std::numeric_limits<TRep>::is_signed, std::int64_t, std::uint64_t>;
+            constexpr auto kNum = static_cast<TNarrow>(TDivide::num);
+            constexpr auto kDen = static_cast<TNarrow>(TDivide::den);
+            const auto value = static_cast<TNarrow>(from.value());
+            // |value % den * num| < den * num, which the caller checked to fit in 64 bits
+            return TTo(static_cast<typename TTo::rep>(
+                static_cast<TCommonRep>(value / kDen) * static_cast<TCommonRep>(kNum) +
+                static_cast<TCommonRep>(value % kDen * kNum / kDen)
+            ));
+        }
+    };
 } // namespace detail
 
-using identity = std::ratio<1>;
-
-using kilo = std::ratio<detail::pow<std::int64_t, 1000, 1>::value>;
-using mega = std::ratio<detail::pow<std::int64_t, 1000, 2>::value>;
-using giga = std::ratio<detail::pow<std::int64_t, 1000, 3>::value>;
-using tera = std::ratio<detail::pow<std::int64_t, 1000, 4>::value>;
-using peta = std::ratio<detail::pow<std::int64_t, 1000, 5>::value>;
-using exa = std::ratio<detail::pow<std::int64_t, 1000, 6>::value>;
-
-using kibi = std::ratio<detail::pow<std::int64_t, 1024, 1>::value>;
-using mebi = std::ratio<detail::pow<std::int64_t, 1024, 2>::value>;
-using gibi = std::ratio<detail::pow<std::int64_t, 1024, 3>::value>;
-using tebi = std::ratio<detail::pow<std::int64_t, 1024, 4>::value>;
-using pebi = std::ratio<detail::pow<std::int64_t, 1024, 5>::value>;
-using exbi = std::ratio<detail::pow<std::int64_t, 1024, 6>::value>;
-
-using bytes = unit<std::int64_t, identity>;
-using kilobytes = unit<std::int64_t, kilo>;
-using megabytes = unit<std::int64_t, mega>;
-using gigabytes = unit<std::int64_t, giga>;
-using terabytes = unit<std::int64_t, tera>;
-using petabytes = unit<std::int64_t, peta>;
-using exabytes = unit<std::int64_t, exa>;
-
-using kibibytes = unit<std::int64_t, kibi>;
-using mebibytes = unit<std::int64_t, mebi>;
-using gibibytes = unit<std::int64_t, gibi>;
-using tebibytes = unit<std::int64_t, tebi>;
-using pebibytes = unit<std::int64_t, pebi>;
-using exbibytes = unit<std::int64_t, exbi>;
+#if PROX_DIGITAL_HAS_CONCEPTS
+/// Any specialization of `unit`
+template <typename T>
+concept any_unit = detail::is_specialization_of_v<std::remove_cv_t<T>, unit>;
+
+namespace detail {
+    /// A value of `TFrom` converts to `TTo` without truncating a fractional part
+    template <typename TFrom, typename TTo>
+    concept lossless_rep = std::is_convertible_v<const TFrom&, TTo> &&
+                           (std::is_floating_point_v<TTo> || !std::is_floating_point_v<TFrom>);
+
+    /// A unit of `TRep2`/`TRatio2` converts to `TRep`/`TRatio` exactly
+    template <typename TRep2, typename TRatio2, typename TRep, typename TRatio>
+    concept lossless_unit = std::is_convertible_v<const TRep2&, TRep> &&
+                            (std::is_floating_point_v<TRep> ||
+                             (is_harmonic<TRatio, TRatio2>::value && !std::is_floating_point_v<TRep2>));
+
+    template <typename T>
+    constexpr auto three_way(const T& lhs, const T& rhs) {
+        if constexpr (std::three_way_comparable<T>) {
+            return lhs <=> rhs;
+        } else {
+            return lhs < rhs   ? std::weak_ordering::less
+                   : rhs < lhs ? std::weak_ordering::greater
+                               : std::weak_ordering::equivalent;
+        }
+    }
+} // namespace detail
+#endif
 
 template <typename TTo, typename TRep, typename TRatio>
-[[nodiscard]] constexpr auto unit_cast(unit<TRep, TRatio> from
-) -> std::enable_if_t<detail::is_specialization_of_v<TTo, unit>, TTo> {
+[[nodiscard]] constexpr auto unit_cast(unit<TRep, TRatio> from)
+    -> PROX_DIGITAL_REQUIRES((detail::is_specialization_of_v<TTo, unit>), TTo) {
     if constexpr (std::is_same_v<TTo, unit<TRep, TRatio>>) {
         return from;
     } else {
         using TDivide = std::ratio_divide<TRatio, typename TTo::ratio>;
         using TCommonRep = std::common_type_t<typename TTo::rep, TRep, std::int64_t>;
-        return detail::unit_cast<TTo, TDivide, TCommonRep, TDivide::num == 1, TDivide::den == 1>{}(from);
+        constexpr bool kNumIsOne = TDivide::num == 1;
+        constexpr bool kDenIsOne = TDivide::den == 1;
+        constexpr bool kMayOverflow =
+            !kNumIsOne && !kDenIsOne && detail::may_overflow_v<TRep, TCommonRep, TDivide::num>;
+        constexpr bool kWidening = !kNumIsOne && !kDenIsOne && !kMayOverflow &&
+                                   detail::is_widening_v<TRep, typename TTo::rep> &&
+                                   TDivide::num <= std::numeric_limits<std::int64_t>::max() / TDivide::den;
+        return detail::unit_cast<TTo, TDivide, TCommonRep, kNumIsOne, kDenIsOne, kMayOverflow, kWidening>{}(
+            from
+        );
     }
 }
 
@@ -401,6 +709,16 @@ public:
 
     constexpr unit() = default;
 
+#if PROX_DIGITAL_HAS_CONCEPTS
+    template <detail::lossless_rep<TRep> TRep2>
+    constexpr explicit unit(const TRep2& other)
+        : mValue(static_cast<TRep>(other)) {}
+
+    template <typename TRep2, typename TRatio2>
+        requires detail::lossless_unit<TRep2, TRatio2, TRep, TRatio>
+    constexpr unit(const unit<TRep2, TRatio2>& v)
+        : mValue(unit_cast<unit>(v).value()) {}
+#else
     template <
         typename TRep2,
         std::enable_if_t<
@@ -420,6 +738,7 @@ public:
             bool> = true>
     constexpr unit(const unit<TRep2, TRatio2>& v)
         : mValue(unit_cast<unit>(v).value()) {}
+#endif
 
     unit(const unit&) = default;
 
@@ -467,6 +786,21 @@ public:
         return *this;
     }
 
+#if PROX_DIGITAL_HAS_CONCEPTS
+    constexpr unit& operator%=(const TRep& rhs)
+        requires(!std::is_floating_point_v<TRep>)
+    {
+        mValue %= rhs;
+        return *this;
+    }
+
+    constexpr unit& operator%=(const unit& rhs)
+        requires(!std::is_floating_point_v<TRep>)
+    {
+        mValue %= rhs.mValue;
+        return *this;
+    }
+#else
     template <typename TRep2 = TRep>
     constexpr auto operator%=(const TRep& rhs) -> std::enable_if_t<!std::is_floating_point_v<TRep2>, unit&> {
         mValue %= rhs;
@@ -478,11 +812,59 @@ public:
         mValue %= rhs.mValue;
         return *this;
     }
+#endif
 
 private:
     TRep mValue;
 };
 
+namespace detail {
+    template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
+    struct compare_traits {
+        using common = std::common_type_t<unit<TRep1, TRatio1>, unit<TRep2, TRatio2>>;
+        static constexpr std::intmax_t lhs_factor = std::ratio_divide<TRatio1, typename common::ratio>::num;
+        static constexpr std::intmax_t rhs_factor = std::ratio_divide<TRatio2, typename common::ratio>::num;
+    };
+
+    /// Whether bringing either side of a comparison to the common unit may overflow, 128-bit reps included
+    template <
+        typename TRep1,
+        typename TRatio1,
+        typename TRep2,
+        typename TRatio2,
+        typename TTraits = compare_traits<TRep1, TRatio1, TRep2, TRatio2>,
+        typename TCommonRep = typename TTraits::common::rep>
+    inline constexpr bool may_overflow_compare_v =
+        may_overflow_v<TRep1, TCommonRep, TTraits::lhs_factor> ||
+        may_overflow_v<TRep2, TCommonRep, TTraits::rhs_factor>;
+
+    template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
+    constexpr int compare_scaled(const unit<TRep1, TRatio1>& lhs, const unit<TRep2, TRatio2>& rhs) {
+        using TTraits = compare_traits<TRep1, TRatio1, TRep2, TRatio2>;
+        using TCommonRep = typename TTraits::common::rep;
+        return wide::compare_scaled<TTraits::lhs_factor, TTraits::rhs_factor>(
+            static_cast<TCommonRep>(lhs.value()), static_cast<TCommonRep>(rhs.value())
+        );
+    }
+
+    /// `std::hash` of a rep; 128-bit values, which `std::hash` only supports in GNU modes, are folded into
+    /// 64 bits so that the high half only contributes outside of the 64-bit range
+    template <typename TRep>
+    std::size_t hash_rep(const TRep& value) {
+        if constexpr (is_integral_rep_v<TRep> && sizeof(TRep) > sizeof(std::uint64_t)) {
+            constexpr std::uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+            const auto lo = static_cast<std::uint64_t>(value);
+            auto hi = static_cast<std::uint64_t>(value >> 64);
+            if constexpr (std::numeric_limits<TRep>::is_signed) {
+                hi += lo >> 63;
+            }
+            return lo ^ hi * kMultiplier;
+        } else {
+            return std::hash<TRep>{}(value);
+        }
+    }
+} // namespace detail
+
 /// Comparison operators
 template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
 [[nodiscard]] constexpr bool operator==(
@@ -492,11 +874,29 @@ template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
     using TCT = std::common_type_t<decltype(lhs), decltype(rhs)>;
     if constexpr (std::is_same_v<TRatio1, TRatio2>) {
         return TCT(lhs).value() == TCT(rhs).value();
+    } else if constexpr (detail::may_overflow_compare_v<TRep1, TRatio1, TRep2, TRatio2>) {
+        return detail::compare_scaled(lhs, rhs) == 0;
     } else {
         return unit_cast<TCT>(lhs).value() == unit_cast<TCT>(rhs).value();
     }
 }
 
+#if PROX_DIGITAL_HAS_CONCEPTS
+template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
+[[nodiscard]] constexpr auto operator<=>(
+    const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep1, TRatio1>& lhs,
+    const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep2, TRatio2>& rhs
+) {
+    using TCT = std::common_type_t<unit<TRep1, TRatio1>, unit<TRep2, TRatio2>>;
+    if constexpr (std::is_same_v<TRatio1, TRatio2>) {
+        return detail::three_way(TCT(lhs).value(), TCT(rhs).value());
+    } else if constexpr (detail::may_overflow_compare_v<TRep1, TRatio1, TRep2, TRatio2>) {
+        return detail::compare_scaled(lhs, rhs) <=> 0;
+    } else {
+        return detail::three_way(unit_cast<TCT>(lhs).value(), unit_cast<TCT>(rhs).value());
+    }
+}
+#else
 template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
 [[nodiscard]] constexpr bool operator!=(
     const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep1, TRatio1>& lhs,
@@ -513,6 +913,8 @@ template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
     using TCT = std::common_type_t<decltype(lhs), decltype(rhs)>;
     if constexpr (std::is_same<TRatio1, TRatio2>::value) {
         return TCT(lhs).value() < TCT(rhs).value();
+    } else if constexpr (detail::may_overflow_compare_v<TRep1, TRatio1, TRep2, TRatio2>) {
+        return detail::compare_scaled(lhs, rhs) < 0;
     } else {
         return unit_cast<TCT>(lhs).value() < unit_cast<TCT>(rhs).value();
     }
@@ -541,6 +943,7 @@ template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
 ) {
     return !(lhs < rhs);
 }
+#endif
 
 /// Arithmetic operators
 template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
@@ -575,10 +978,11 @@ template <typename TRep1, typename TRep2, typename TRatio>
 }
 
 template <typename TRep1, typename TRatio, typename TRep2>
-[[nodiscard]] constexpr unit<
-    detail::common_rep<TRep1, std::enable_if_t<!detail::is_specialization_of_v<TRep2, unit>, TRep2>>,
-    TRatio>
-operator/(const unit<TRep1, TRatio>& lhs, const TRep2& rhs) {
+[[nodiscard]] constexpr auto operator/(const unit<TRep1, TRatio>& lhs, const TRep2& rhs)
+    -> PROX_DIGITAL_REQUIRES(
+        (!detail::is_specialization_of_v<TRep2, unit>),
+        unit<detail::common_rep<TRep1, TRep2>, TRatio>
+    ) {
     using TCT = unit<std::common_type_t<TRep1, TRep2>, TRatio>;
     return TCT(TCT(lhs).value() / rhs);
 }
@@ -591,10 +995,11 @@ template <typename TRep1, typename TRatio1, typename TRep2, typename TRatio2>
 }
 
 template <typename TRep1, typename TRatio, typename TRep2>
-[[nodiscard]] constexpr unit<
-    detail::common_rep<TRep1, std::enable_if_t<!detail::is_specialization_of_v<TRep2, unit>, TRep2>>,
-    TRatio>
-operator%(const unit<TRep1, TRatio>& lhs, const TRep2& rhs) {
+[[nodiscard]] constexpr auto operator%(const unit<TRep1, TRatio>& lhs, const TRep2& rhs)
+    -> PROX_DIGITAL_REQUIRES(
+        (!detail::is_specialization_of_v<TRep2, unit>),
+        unit<detail::common_rep<TRep1, TRep2>, TRatio>
+    ) {
     using TCT = unit<std::common_type_t<TRep1, TRep2>, TRatio>;
     return TCT(TCT(lhs).value() % rhs);
 }
@@ -614,25 +1019,25 @@ template <typename TRep, typename TRatio>
 }
 
 template <typename TToUnit, typename TRep, typename TRatio>
-[[nodiscard]] constexpr auto floor(const unit<TRep, TRatio>& v
-) -> std::enable_if_t<detail::is_specialization_of_v<TToUnit, unit>, TToUnit> {
+[[nodiscard]] constexpr auto floor(const unit<TRep, TRatio>& v)
+    -> PROX_DIGITAL_REQUIRES((detail::is_specialization_of_v<TToUnit, unit>), TToUnit) {
     const auto res = unit_cast<TToUnit>(v);
     return res > v ? (res - TToUnit{ 1 }) : res;
 }
 
 template <typename TToUnit, typename TRep, typename TRatio>
-[[nodiscard]] constexpr auto ceil(const unit<TRep, TRatio>& v
-) -> std::enable_if_t<detail::is_specialization_of_v<TToUnit, unit>, TToUnit> {
+[[nodiscard]] constexpr auto ceil(const unit<TRep, TRatio>& v)
+    -> PROX_DIGITAL_REQUIRES((detail::is_specialization_of_v<TToUnit, unit>), TToUnit) {
     const auto res = unit_cast<TToUnit>(v);
     return res < v ? (res + TToUnit{ 1 }) : res;
 }
 
 /// Round half-even (bankers' rounding)
 template <typename TToUnit, typename TRep, typename TRatio>
-[[nodiscard]] constexpr auto round(const unit<TRep, TRatio>& v)
-    -> std::enable_if_t<
-        detail::is_specialization_of_v<TToUnit, unit> && !std::is_floating_point_v<typename TToUnit::rep>,
-        TToUnit> {
+[[nodiscard]] constexpr auto round(const unit<TRep, TRatio>& v) -> PROX_DIGITAL_REQUIRES(
+    (detail::is_specialization_of_v<TToUnit, unit> && !std::is_floating_point_v<typename TToUnit::rep>),
+    TToUnit
+) {
     const TToUnit v1 = floor<TToUnit>(v);
     const TToUnit v2 = v1 + TToUnit{ 1 };
     const auto d1 = v - v1;
@@ -775,6 +1180,204 @@ inline namespace literals {
             return unit<long double, exbi>(x);
         }
     } // namespace unit_literals
+
+    /// The `unit_literals` with fractional literals producing `unit<double, ...>` rather than
+    /// `unit<long double, ...>`, which keeps x87 arithmetic out of the code they propagate into.
+    /// Use instead of `unit_literals`, not next to it.
+    namespace double_literals {
+        // power-10, integral
+        template <char... TDigits>
+        constexpr auto operator""_B() {
+            return detail::literal::parse<bytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_KB() {
+            return detail::literal::parse<kilobytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_MB() {
+            return detail::literal::parse<megabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_GB() {
+            return detail::literal::parse<gigabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_TB() {
+            return detail::literal::parse<terabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_PB() {
+            return detail::literal::parse<petabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_EB() {
+            return detail::literal::parse<exabytes, TDigits...>();
+        }
+
+        // power-2, integral
+        template <char... TDigits>
+        constexpr auto operator""_KiB() {
+            return detail::literal::parse<kibibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_MiB() {
+            return detail::literal::parse<mebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_GiB() {
+            return detail::literal::parse<gibibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_TiB() {
+            return detail::literal::parse<tebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_PiB() {
+            return detail::literal::parse<pebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_EiB() {
+            return detail::literal::parse<exbibytes, TDigits...>();
+        }
+
+        // power-10, floating
+        constexpr auto operator""_B(long double x) {
+            return unit<double, identity>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_KB(long double x) {
+            return unit<double, kilo>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_MB(long double x) {
+            return unit<double, mega>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_GB(long double x) {
+            return unit<double, giga>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_TB(long double x) {
+            return unit<double, tera>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_PB(long double x) {
+            return unit<double, peta>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_EB(long double x) {
+            return unit<double, exa>(static_cast<double>(x));
+        }
+
+        // power-2, floating
+        constexpr auto operator""_KiB(long double x) {
+            return unit<double, kibi>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_MiB(long double x) {
+            return unit<double, mebi>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_GiB(long double x) {
+            return unit<double, gibi>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_TiB(long double x) {
+            return unit<double, tebi>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_PiB(long double x) {
+            return unit<double, pebi>(static_cast<double>(x));
+        }
+
+        constexpr auto operator""_EiB(long double x) {
+            return unit<double, exbi>(static_cast<double>(x));
+        }
+    } // namespace double_literals
+
+    /// The `unit_literals` with fractional literals evaluated exactly at compile time into `bytes`:
+    /// `1.5_GiB` is `bytes(1'610'612'736)`, and `0.3_KiB` is a compile error as it isn't a whole
+    /// number of bytes. Integral literals keep their unit. Use instead of `unit_literals`, not next to it.
+    namespace exact_literals {
+        // power-10
+        template <char... TDigits>
+        constexpr auto operator""_B() {
+            return detail::literal::parse_exact<bytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_KB() {
+            return detail::literal::parse_exact<kilobytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_MB() {
+            return detail::literal::parse_exact<megabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_GB() {
+            return detail::literal::parse_exact<gigabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_TB() {
+            return detail::literal::parse_exact<terabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_PB() {
+            return detail::literal::parse_exact<petabytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_EB() {
+            return detail::literal::parse_exact<exabytes, TDigits...>();
+        }
+
+        // power-2
+        template <char... TDigits>
+        constexpr auto operator""_KiB() {
+            return detail::literal::parse_exact<kibibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_MiB() {
+            return detail::literal::parse_exact<mebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_GiB() {
+            return detail::literal::parse_exact<gibibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_TiB() {
+            return detail::literal::parse_exact<tebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_PiB() {
+            return detail::literal::parse_exact<pebibytes, TDigits...>();
+        }
+
+        template <char... TDigits>
+        constexpr auto operator""_EiB() {
+            return detail::literal::parse_exact<exbibytes, TDigits...>();
+        }
+    } // namespace exact_literals
 } // namespace literals
 } // namespace PROX_DIGITAL_NAMESPACE_NAME
 
@@ -798,13 +1401,10 @@ struct common_type<PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>> {
     using type = PROX_DIGITAL_NAMESPACE_NAME::unit<typename common_type<TRep>::type, typename TRatio::type>;
 };
 
-template <typename T>
-struct hash;
-
 template <typename TRep, typename TRatio>
 struct hash<PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>> {
     constexpr std::size_t operator()(const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>& u) const {
-        return std::hash<TRep>{}(u.value());
+        return PROX_DIGITAL_NAMESPACE_NAME::detail::hash_rep(u.value());
     }
 };
 } // namespace std
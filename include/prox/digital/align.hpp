@@ -0,0 +1,291 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_ALIGN_HPP_
+#define PROX_DIGITAL_ALIGN_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+namespace detail {
+    namespace align {
+        template <typename TRep>
+        using unsigned_t = std::make_unsigned_t<TRep>;
+
+        constexpr bool is_pow2(std::uintmax_t v) {
+            return v != 0 && (v & (v - 1)) == 0;
+        }
+
+        constexpr int bit_width(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+            return v == 0 ? 0 : 64 - __builtin_clzll(v);
+#else
+            int width = 0;
+            for (int shift = 32; shift > 0; shift /= 2) {
+                if ((v >> shift) != 0) {
+                    v >>= shift;
+                    width += shift;
+                }
+            }
+            return width + static_cast<int>(v);
+#endif
+        }
+
+        /// One `TGranule` counted in units of `TRatio`, which must be a whole power of two
+        template <typename TGranule, typename TRatio>
+        constexpr std::uintmax_t static_granule() {
+            static_assert(is_specialization_of_v<TGranule, unit>, "The granularity must be a digital unit");
+            using TDivide = std::ratio_divide<typename TGranule::ratio, TRatio>;
+            static_assert(TDivide::den == 1, "The granularity must be a whole number of the aligned unit");
+            static_assert(
+                is_pow2(static_cast<std::uintmax_t>(TDivide::num)), "The granularity must be a power of two"
+            );
+            return static_cast<std::uintmax_t>(TDivide::num);
+        }
+
+        /// A granularity value counted in units of `TRatio`
+        template <typename TRatio, typename TRep2, typename TRatio2>
+        constexpr std::uintmax_t count(const unit<TRep2, TRatio2>& g) {
+            static_assert(std::is_integral_v<TRep2>, "The granularity must be integral");
+            using TDivide = std::ratio_divide<TRatio2, TRatio>;
+            static_assert(TDivide::den == 1, "The granularity must be a whole number of the aligned unit");
+            return static_cast<std::uintmax_t>(g.value()) * static_cast<std::uintmax_t>(TDivide::num);
+        }
+
+        /// `count` of a granularity that must be a power of two; throws `std::invalid_argument` otherwise,
+        /// which fails constant evaluation for constant granularities
+        template <typename TRatio, typename TRep2, typename TRatio2>
+        constexpr std::uintmax_t granule(const unit<TRep2, TRatio2>& g) {
+            const std::uintmax_t res = count<TRatio>(g);
+            if (g.value() <= 0 || !is_pow2(res)) {
+                throw std::invalid_argument("the granularity must be a power of two");
+            }
+            return res;
+        }
+
+        /// Throws `std::invalid_argument` unless an output of `out` elements can hold `in` elements
+        inline void check_output(std::size_t in, std::size_t out) {
+            if (out < in) {
+                throw std::invalid_argument("the output span is smaller than the input");
+            }
+        }
+
+        // the arithmetic is done on the unsigned type, where wrapping is defined and the masks floor
+        template <typename TRep>
+        constexpr TRep up(TRep v, std::uintmax_t g) {
+            using TUnsigned = unsigned_t<TRep>;
+            const auto mask = static_cast<TUnsigned>(g - 1);
+            const auto biased = static_cast<TUnsigned>(static_cast<TUnsigned>(v) + mask);
+            return static_cast<TRep>(static_cast<TUnsigned>(biased & static_cast<TUnsigned>(~mask)));
+        }
+
+        template <typename TRep>
+        constexpr TRep down(TRep v, std::uintmax_t g) {
+            using TUnsigned = unsigned_t<TRep>;
+            const auto mask = static_cast<TUnsigned>(~static_cast<TUnsigned>(g - 1));
+            return static_cast<TRep>(static_cast<TUnsigned>(static_cast<TUnsigned>(v) & mask));
+        }
+
+        template <typename TRep>
+        constexpr bool aligned(TRep v, std::uintmax_t g) {
+            using TUnsigned = unsigned_t<TRep>;
+            return static_cast<TUnsigned>(static_cast<TUnsigned>(v) & static_cast<TUnsigned>(g - 1)) == 0;
+        }
+
+        template <typename TRep>
+        inline constexpr bool is_alignable_v = std::is_integral_v<TRep> && !std::is_same_v<TRep, bool>;
+    } // namespace align
+} // namespace detail
+
+/// Rounds `v` up to a multiple of one `TGranule`, e.g. `align_up<kibibytes>(size)`. The granule must be a
+/// power of two of `v`'s unit; the result is a mask, not a division. Negative values round toward +inf.
+template <typename TGranule, typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto align_up(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    constexpr std::uintmax_t kGranule = detail::align::static_granule<TGranule, TRatio>();
+    return unit<TRep, TRatio>(detail::align::up(v.value(), kGranule));
+}
+
+/// Rounds `v` down to a multiple of one `TGranule`, toward -inf for negative values
+template <typename TGranule, typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto align_down(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    constexpr std::uintmax_t kGranule = detail::align::static_granule<TGranule, TRatio>();
+    return unit<TRep, TRatio>(detail::align::down(v.value(), kGranule));
+}
+
+template <typename TGranule, typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto is_aligned(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, bool> {
+    constexpr std::uintmax_t kGranule = detail::align::static_granule<TGranule, TRatio>();
+    return detail::align::aligned(v.value(), kGranule);
+}
+
+/// Rounds `v` up to a multiple of `granularity`, e.g. `align_up(size, 4_KiB)`. The granularity must be a
+/// power of two of `v`'s unit (`std::invalid_argument` otherwise); with a constant granularity this
+/// compiles to the same mask as the template form.
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+[[nodiscard]] constexpr auto align_up(const unit<TRep, TRatio>& v, const unit<TRep2, TRatio2>& granularity)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    return unit<TRep, TRatio>(detail::align::up(v.value(), detail::align::granule<TRatio>(granularity)));
+}
+
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+[[nodiscard]] constexpr auto align_down(const unit<TRep, TRatio>& v, const unit<TRep2, TRatio2>& granularity)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    return unit<TRep, TRatio>(detail::align::down(v.value(), detail::align::granule<TRatio>(granularity)));
+}
+
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+[[nodiscard]] constexpr auto is_aligned(const unit<TRep, TRatio>& v, const unit<TRep2, TRatio2>& granularity)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, bool> {
+    return detail::align::aligned(v.value(), detail::align::granule<TRatio>(granularity));
+}
+
+/// The smallest power of two of `v`'s unit not less than `v`, e.g. `bit_ceil(3_KiB) == 4_KiB`.
+/// Values below one give one unit; the result must be representable.
+template <typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto bit_ceil(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    static_assert(sizeof(TRep) <= sizeof(std::uint64_t), "bit_ceil supports representations up to 64 bits");
+    if (v.value() <= 1) {
+        return unit<TRep, TRatio>(TRep{ 1 });
+    }
+    const int width = detail::align::bit_width(static_cast<std::uint64_t>(v.value() - 1));
+    return unit<TRep, TRatio>(static_cast<TRep>(std::uint64_t{ 1 } << width));
+}
+
+/// The largest power of two of `v`'s unit not greater than `v`, zero for values below one
+template <typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto bit_floor(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>> {
+    static_assert(sizeof(TRep) <= sizeof(std::uint64_t), "bit_floor supports representations up to 64 bits");
+    if (v.value() < 1) {
+        return unit<TRep, TRatio>(TRep{ 0 });
+    }
+    const int width = detail::align::bit_width(static_cast<std::uint64_t>(v.value()));
+    return unit<TRep, TRatio>(static_cast<TRep>(std::uint64_t{ 1 } << (width - 1)));
+}
+
+/// floor(log2) of the count of `v`, which must be positive: `log2(4_KiB) == 2`, `log2(4'096_B) == 12`
+template <typename TRep, typename TRatio>
+[[nodiscard]] constexpr auto log2(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::align::is_alignable_v<TRep>, int> {
+    static_assert(sizeof(TRep) <= sizeof(std::uint64_t), "log2 supports representations up to 64 bits");
+    return detail::align::bit_width(static_cast<std::uint64_t>(v.value())) - 1;
+}
+
+/// Aligns every extent in [first, last) up to `granularity` and writes the results starting at `out`,
+/// which may be `first`. Returns the iterator past the last element written.
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+auto align_up(
+    const unit<TRep, TRatio>* first,
+    const unit<TRep, TRatio>* last,
+    unit<TRep, TRatio>* out,
+    const unit<TRep2, TRatio2>& granularity
+) -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>*> {
+    const std::uintmax_t g = detail::align::granule<TRatio>(granularity);
+    for (; first != last; ++first, ++out) {
+        *out = unit<TRep, TRatio>(detail::align::up(first->value(), g));
+    }
+    return out;
+}
+
+/// Aligns every extent in [first, last) down to `granularity`, see `align_up`
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+auto align_down(
+    const unit<TRep, TRatio>* first,
+    const unit<TRep, TRatio>* last,
+    unit<TRep, TRatio>* out,
+    const unit<TRep2, TRatio2>& granularity
+) -> std::enable_if_t<detail::align::is_alignable_v<TRep>, unit<TRep, TRatio>*> {
+    const std::uintmax_t g = detail::align::granule<TRatio>(granularity);
+    for (; first != last; ++first, ++out) {
+        *out = unit<TRep, TRatio>(detail::align::down(first->value(), g));
+    }
+    return out;
+}
+
+/// Whether every extent in [first, last) is a multiple of `granularity`
+template <typename TRep, typename TRatio, typename TRep2, typename TRatio2>
+auto is_aligned(
+    const unit<TRep, TRatio>* first,
+    const unit<TRep, TRatio>* last,
+    const unit<TRep2, TRatio2>& granularity
+) -> std::enable_if_t<detail::align::is_alignable_v<TRep>, bool> {
+    using TUnsigned = detail::align::unsigned_t<TRep>;
+    const auto mask = static_cast<TUnsigned>(detail::align::granule<TRatio>(granularity) - 1);
+    // OR everything together instead of returning early, which keeps the loop vectorizable
+    TUnsigned bits = 0;
+    for (; first != last; ++first) {
+        bits = static_cast<TUnsigned>(bits | static_cast<TUnsigned>(first->value()));
+    }
+    return static_cast<TUnsigned>(bits & mask) == 0;
+}
+
+#if defined(__cpp_lib_span)
+/// Aligns `in` element-wise into the front of `out`, which must be at least as large as `in`
+/// (`std::invalid_argument` otherwise) and may be `in` itself. Returns the written part of `out`.
+template <typename TFrom, std::size_t TExtent1, typename TTo, std::size_t TExtent2, typename TGranule>
+auto align_up(std::span<TFrom, TExtent1> in, std::span<TTo, TExtent2> out, const TGranule& granularity)
+    -> std::enable_if_t<std::is_same_v<std::remove_const_t<TFrom>, TTo>, std::span<TTo>> {
+    detail::align::check_output(in.size(), out.size());
+    const TFrom* first = in.data();
+    align_up(first, first + in.size(), out.data(), granularity);
+    return out.first(in.size());
+}
+
+template <typename TFrom, std::size_t TExtent1, typename TTo, std::size_t TExtent2, typename TGranule>
+auto align_down(std::span<TFrom, TExtent1> in, std::span<TTo, TExtent2> out, const TGranule& granularity)
+    -> std::enable_if_t<std::is_same_v<std::remove_const_t<TFrom>, TTo>, std::span<TTo>> {
+    detail::align::check_output(in.size(), out.size());
+    const TFrom* first = in.data();
+    align_down(first, first + in.size(), out.data(), granularity);
+    return out.first(in.size());
+}
+
+template <typename TFrom, std::size_t TExtent, typename TGranule>
+bool is_aligned(std::span<TFrom, TExtent> in, const TGranule& granularity) {
+    const TFrom* first = in.data();
+    return is_aligned(first, first + in.size(), granularity);
+}
+#endif
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_ALIGN_HPP_
@@ -0,0 +1,261 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_ATOMIC_HPP_
+#define PROX_DIGITAL_ATOMIC_HPP_
+
+#include <prox/digital.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Peak of an `atomic_unit` together with the epoch it was observed in
+template <typename TUnit>
+struct peak_sample {
+    TUnit peak;
+    std::uint64_t epoch;
+};
+
+/// A lock-free atomic counter of a digital unit, mirroring `std::atomic`
+///
+/// Every modification also maintains a high-water mark, which can be read with `peak()` and restarted
+/// with `reset_peak()`; each reset begins a new epoch. Additions accept any unit that converts into
+/// `TRatio` exactly (e.g. `KiB` into an atomic `bytes` counter).
+template <typename TRep, typename TRatio = std::ratio<1>>
+class atomic_unit final {
+    static_assert(std::is_integral_v<TRep>, "atomic_unit needs an integral representation");
+    static_assert(std::atomic<TRep>::is_always_lock_free, "atomic_unit must be lock-free");
+
+    template <typename TRep2, typename TRatio2>
+    using enable_if_harmonic = std::enable_if_t<
+        std::is_integral_v<TRep2> && std::is_convertible_v<const TRep2&, TRep> &&
+            detail::is_harmonic<TRatio, TRatio2>::value,
+        bool>;
+
+public:
+    using unit_type = unit<TRep, TRatio>;
+    using rep = TRep;
+    using ratio = TRatio;
+
+    static constexpr bool is_always_lock_free = true;
+
+    constexpr atomic_unit() noexcept
+        : atomic_unit(unit_type::zero()) {}
+
+    constexpr atomic_unit(unit_type v) noexcept
+        : mValue(v.value())
+        , mPeak(v.value())
+        , mEpoch(0) {}
+
+    atomic_unit(const atomic_unit&) = delete;
+
+    atomic_unit& operator=(const atomic_unit&) = delete;
+
+    ~atomic_unit() = default;
+
+    [[nodiscard]] bool is_lock_free() const noexcept { return mValue.is_lock_free(); }
+
+    [[nodiscard]] unit_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        return unit_type(mValue.load(order));
+    }
+
+    operator unit_type() const noexcept { return load(); }
+
+    void store(unit_type v, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        mValue.store(v.value(), order);
+        raise_peak(v.value());
+    }
+
+    unit_type operator=(unit_type v) noexcept {
+        store(v);
+        return v;
+    }
+
+    unit_type exchange(unit_type v, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        const TRep prev = mValue.exchange(v.value(), order);
+        raise_peak(v.value());
+        return unit_type(prev);
+    }
+
+    bool compare_exchange_weak(
+        unit_type& expected,
+        unit_type desired,
+        std::memory_order success,
+        std::memory_order failure
+    ) noexcept {
+        TRep raw = expected.value();
+        if (mValue.compare_exchange_weak(raw, desired.value(), success, failure)) {
+            raise_peak(desired.value());
+            return true;
+        }
+        expected = unit_type(raw);
+        return false;
+    }
+
+    bool compare_exchange_weak(
+        unit_type& expected,
+        unit_type desired,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept {
+        return compare_exchange_weak(expected, desired, order, failure_order(order));
+    }
+
+    bool compare_exchange_strong(
+        unit_type& expected,
+        unit_type desired,
+        std::memory_order success,
+        std::memory_order failure
+    ) noexcept {
+        TRep raw = expected.value();
+        if (mValue.compare_exchange_strong(raw, desired.value(), success, failure)) {
+            raise_peak(desired.value());
+            return true;
+        }
+        expected = unit_type(raw);
+        return false;
+    }
+
+    bool compare_exchange_strong(
+        unit_type& expected,
+        unit_type desired,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept {
+        return compare_exchange_strong(expected, desired, order, failure_order(order));
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    unit_type fetch_add(
+        const unit<TRep2, TRatio2>& delta,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept {
+        const TRep d = unit_type(delta).value();
+        const TRep prev = mValue.fetch_add(d, order);
+        raise_peak(wrapping_add(prev, d));
+        return unit_type(prev);
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    unit_type fetch_sub(
+        const unit<TRep2, TRatio2>& delta,
+        std::memory_order order = std::memory_order_seq_cst
+    ) noexcept {
+        const TRep d = unit_type(delta).value();
+        const TRep prev = mValue.fetch_sub(d, order);
+        raise_peak(wrapping_sub(prev, d));
+        return unit_type(prev);
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    unit_type operator+=(const unit<TRep2, TRatio2>& delta) noexcept {
+        const TRep d = unit_type(delta).value();
+        return unit_type(wrapping_add(fetch_add(unit_type(d)).value(), d));
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    unit_type operator-=(const unit<TRep2, TRatio2>& delta) noexcept {
+        const TRep d = unit_type(delta).value();
+        return unit_type(wrapping_sub(fetch_sub(unit_type(d)).value(), d));
+    }
+
+    unit_type operator++() noexcept { return *this += unit_type(TRep(1)); }
+
+    unit_type operator++(int) noexcept { return fetch_add(unit_type(TRep(1))); }
+
+    unit_type operator--() noexcept { return *this -= unit_type(TRep(1)); }
+
+    unit_type operator--(int) noexcept { return fetch_sub(unit_type(TRep(1))); }
+
+#if defined(__cpp_lib_atomic_wait)
+    /// Blocks while the value equals `old`
+    void wait(unit_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        mValue.wait(old.value(), order);
+    }
+
+    void notify_one() noexcept { mValue.notify_one(); }
+
+    void notify_all() noexcept { mValue.notify_all(); }
+#endif
+
+    /// Highest value held since construction or the last `reset_peak()`
+    [[nodiscard]] unit_type peak(std::memory_order order = std::memory_order_acquire) const noexcept {
+        return unit_type(mPeak.load(order));
+    }
+
+    /// Number of `reset_peak()` calls so far
+    [[nodiscard]] std::uint64_t epoch(std::memory_order order = std::memory_order_acquire) const noexcept {
+        return mEpoch.load(order);
+    }
+
+    /// Starts a new epoch with the peak lowered to the current value; returns the closed epoch's peak
+    peak_sample<unit_type> reset_peak() noexcept {
+        const TRep prev = mPeak.exchange(mValue.load(std::memory_order_acquire), std::memory_order_acq_rel);
+        const std::uint64_t epoch = mEpoch.fetch_add(1, std::memory_order_acq_rel);
+        // a modification racing with the exchange may have been recorded in the old epoch only
+        raise_peak(mValue.load(std::memory_order_acquire));
+        return { unit_type(prev), epoch };
+    }
+
+private:
+    static constexpr std::memory_order failure_order(std::memory_order order) noexcept {
+        return order == std::memory_order_acq_rel ? std::memory_order_acquire
+               : order == std::memory_order_release ? std::memory_order_relaxed
+                                                    : order;
+    }
+
+    static constexpr TRep wrapping_add(TRep lhs, TRep rhs) noexcept {
+        using TUnsigned = std::make_unsigned_t<TRep>;
+        return static_cast<TRep>(static_cast<TUnsigned>(lhs) + static_cast<TUnsigned>(rhs));
+    }
+
+    static constexpr TRep wrapping_sub(TRep lhs, TRep rhs) noexcept {
+        using TUnsigned = std::make_unsigned_t<TRep>;
+        return static_cast<TRep>(static_cast<TUnsigned>(lhs) - static_cast<TUnsigned>(rhs));
+    }
+
+    void raise_peak(TRep value) noexcept {
+        // the common case is a single relaxed load that finds the peak already higher
+        TRep peak = mPeak.load(std::memory_order_relaxed);
+        while (peak < value &&
+               !mPeak.compare_exchange_weak(peak, value, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::atomic<TRep> mValue;
+    std::atomic<TRep> mPeak;
+    std::atomic<std::uint64_t> mEpoch;
+};
+
+/// Atomic byte counter
+using atomic_bytes = atomic_unit<std::int64_t>;
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_ATOMIC_HPP_
@@ -0,0 +1,217 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_BUDGET_HPP_
+#define PROX_DIGITAL_BUDGET_HPP_
+
+#include <prox/digital.hpp>
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// A lock-free quota of `TUnit`, optionally nested in a parent budget
+///
+/// `try_reserve()` succeeds only if the amount fits into this budget and every ancestor. It charges
+/// this budget first and then each ancestor in turn, undoing the charges made so far when a level
+/// refuses, so a failed reservation leaves no charge behind. The levels are not charged atomically
+/// as a whole: while a reservation is in flight its partial charges are visible, and a concurrent
+/// reservation through a shared ancestor may fail even though the two would have fit one after the
+/// other. No limit is ever exceeded; near a limit a failure means "not now" rather than "never".
+/// Amounts must be non-negative and may be given in any unit converting into `TUnit` exactly.
+/// A parent must outlive its children.
+template <typename TUnit = bytes>
+class budget final {
+    static_assert(detail::is_specialization_of_v<TUnit, unit>, "TUnit must be a digital unit");
+    static_assert(std::is_integral_v<typename TUnit::rep>, "budget needs an integral representation");
+
+    using rep = typename TUnit::rep;
+
+    template <typename TRep2, typename TRatio2>
+    using enable_if_harmonic = std::enable_if_t<
+        std::is_integral_v<TRep2> && detail::is_harmonic<typename TUnit::ratio, TRatio2>::value,
+        bool>;
+
+public:
+    using unit_type = TUnit;
+
+    class lease;
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    explicit budget(const unit<TRep2, TRatio2>& limit, budget* parent = nullptr) noexcept
+        : mLimit(TUnit(limit).value())
+        , mUsed(0)
+        , mParent(parent) {}
+
+    budget(const budget&) = delete;
+
+    budget& operator=(const budget&) = delete;
+
+    ~budget() = default;
+
+    [[nodiscard]] budget* parent() const noexcept { return mParent; }
+
+    [[nodiscard]] TUnit limit() const noexcept { return TUnit(mLimit.load(std::memory_order_relaxed)); }
+
+    [[nodiscard]] TUnit used() const noexcept { return TUnit(mUsed.load(std::memory_order_relaxed)); }
+
+    /// What this budget alone still allows; ancestors may allow less
+    [[nodiscard]] TUnit available() const noexcept {
+        const rep left = mLimit.load(std::memory_order_relaxed) - mUsed.load(std::memory_order_relaxed);
+        return TUnit(left > 0 ? left : rep(0));
+    }
+
+    /// Changes the limit; existing reservations above a lowered limit stay until released
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    void set_limit(const unit<TRep2, TRatio2>& limit) noexcept {
+        mLimit.store(TUnit(limit).value(), std::memory_order_relaxed);
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    [[nodiscard]] bool try_reserve(const unit<TRep2, TRatio2>& amount) noexcept {
+        const rep n = TUnit(amount).value();
+        for (budget* b = this; b != nullptr; b = b->mParent) {
+            if (!b->try_reserve_local(n)) {
+                // roll back what was already charged below the failing level
+                for (budget* r = this; r != b; r = r->mParent) {
+                    r->mUsed.fetch_sub(n, std::memory_order_release);
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    void release(const unit<TRep2, TRatio2>& amount) noexcept {
+        const rep n = TUnit(amount).value();
+        for (budget* b = this; b != nullptr; b = b->mParent) {
+            b->mUsed.fetch_sub(n, std::memory_order_release);
+        }
+    }
+
+    /// A single-threaded local cache of reservations drawn from the budget `chunk` at a time
+    [[nodiscard]] lease make_lease(TUnit chunk) noexcept { return lease(*this, chunk); }
+
+private:
+    bool try_reserve_local(rep n) noexcept {
+        const rep limit = mLimit.load(std::memory_order_relaxed);
+        rep used = mUsed.load(std::memory_order_relaxed);
+        do {
+            // compared as `n > limit - used` so the check itself can't overflow
+            if (used > limit || n > limit - used) {
+                return false;
+            }
+        } while (!mUsed.compare_exchange_weak(used, used + n, std::memory_order_acquire, std::memory_order_relaxed));
+        return true;
+    }
+
+    std::atomic<rep> mLimit;
+    std::atomic<rep> mUsed;
+    budget* mParent;
+};
+
+/// Batches reservations for one thread: the shared budget is touched once per `chunk` instead of
+/// once per reservation. Unused reserve is returned when the lease is destroyed; amounts still
+/// reserved through it at that point stay charged to the budget and must be released there.
+template <typename TUnit>
+class budget<TUnit>::lease final {
+public:
+    lease(budget& owner, TUnit chunk) noexcept
+        : mBudget(&owner)
+        , mChunk(chunk.value())
+        , mReserve(0) {}
+
+    lease(const lease&) = delete;
+
+    lease& operator=(const lease&) = delete;
+
+    lease(lease&& other) noexcept
+        : mBudget(std::exchange(other.mBudget, nullptr))
+        , mChunk(other.mChunk)
+        , mReserve(std::exchange(other.mReserve, rep(0))) {}
+
+    lease& operator=(lease&& other) noexcept {
+        if (this != &other) {
+            give_back(mReserve);
+            mBudget = std::exchange(other.mBudget, nullptr);
+            mChunk = other.mChunk;
+            mReserve = std::exchange(other.mReserve, rep(0));
+        }
+        return *this;
+    }
+
+    ~lease() { give_back(mReserve); }
+
+    /// Reserve drawn from the budget but not handed out yet
+    [[nodiscard]] TUnit reserve() const noexcept { return TUnit(mReserve); }
+
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    [[nodiscard]] bool try_reserve(const unit<TRep2, TRatio2>& amount) noexcept {
+        const rep n = TUnit(amount).value();
+        if (n <= mReserve) {
+            mReserve -= n;
+            return true;
+        }
+        const rep missing = n - mReserve;
+        // prefer a whole chunk, but settle for the exact shortfall near the limit
+        const rep refill = missing > mChunk ? missing : mChunk;
+        if (mBudget->try_reserve(TUnit(refill))) {
+            mReserve += refill - n;
+            return true;
+        }
+        if (refill != missing && mBudget->try_reserve(TUnit(missing))) {
+            mReserve = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /// Returns an amount reserved through this lease, keeping up to two chunks locally
+    template <typename TRep2, typename TRatio2, enable_if_harmonic<TRep2, TRatio2> = true>
+    void release(const unit<TRep2, TRatio2>& amount) noexcept {
+        mReserve += TUnit(amount).value();
+        if (mReserve > 2 * mChunk) {
+            give_back(mReserve - mChunk);
+            mReserve = mChunk;
+        }
+    }
+
+private:
+    void give_back(rep n) noexcept {
+        if (mBudget != nullptr && n != 0) {
+            mBudget->release(TUnit(n));
+        }
+    }
+
+    budget* mBudget;
+    rep mChunk;
+    rep mReserve;
+};
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_BUDGET_HPP_
@@ -0,0 +1,810 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_BULK_HPP_
+#define PROX_DIGITAL_BULK_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define PROX_DIGITAL_X86_DISPATCH 1
+#include <immintrin.h>
+#else
+#define PROX_DIGITAL_X86_DISPATCH 0
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Result of `sum`: the total and whether it exceeded the range of the result's representation.
+/// The total is unspecified when `overflow` is set.
+template <typename TUnit>
+struct sum_result {
+    TUnit value;
+    bool overflow;
+};
+
+namespace detail {
+    namespace bulk {
+        /// Instruction set levels the bulk kernels are compiled for
+        enum class isa { scalar, sse2, avx2, avx512 };
+
+        /// Best instruction set supported by the running CPU, detected once
+        inline isa detect_isa() noexcept {
+#if PROX_DIGITAL_X86_DISPATCH
+            static const isa kIsa = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+                    return isa::avx512;
+                }
+                if (__builtin_cpu_supports("avx2")) {
+                    return isa::avx2;
+                }
+                return isa::sse2;
+            }();
+            return kIsa;
+#else
+            return isa::scalar;
+#endif
+        }
+
+        /// Exponent of a power of two, -1 for anything else
+        constexpr int log2(std::intmax_t value) {
+            if (value <= 0 || (value & (value - 1)) != 0) {
+                return -1;
+            }
+            int exp = 0;
+            for (; value > 1; value >>= 1) {
+                ++exp;
+            }
+            return exp;
+        }
+
+        /// floor(log2(value)) for a positive value
+        constexpr int floor_log2(std::uint64_t value) {
+            int exp = 0;
+            for (; value > 1; value >>= 1) {
+                ++exp;
+            }
+            return exp;
+        }
+
+        /// Multiplier dividing magnitudes up to 2^63 by `d`, which isn't a power of two, as
+        /// mulhi(n, m) >> floor(log2(d)) (Granlund and Montgomery). m = ceil(2^(64 + s) / d) with
+        /// s = floor(log2(d)) fits in 64 bits and errs by m * d - 2^(64 + s) < d < 2^(s + 1), which
+        /// keeps n * m / 2^(64 + s) below floor(n / d) + 1 for every n <= 2^63.
+        constexpr std::uint64_t magic_reciprocal(std::uint64_t d) {
+            std::uint64_t rem = std::uint64_t{ 1 } << floor_log2(d);
+            std::uint64_t quot = 0;
+            for (int bit = 0; bit < 64; ++bit) {
+                rem <<= 1;
+                quot <<= 1;
+                if (rem >= d) {
+                    rem -= d;
+                    quot |= 1U;
+                }
+            }
+            return quot + (rem != 0 ? 1U : 0U);
+        }
+
+        enum class cast_op { scalar, copy, shl, shr, mul, div, cvt };
+
+        /// Selects the vector operation equivalent to `detail::unit_cast<..., TDivide, ...>`.
+        /// Same-rep 64-bit integral conversions and `double` to 64-bit signed integral conversions
+        /// (`cvt`: scale in double, then truncate) are vectorized. Signed divisions by other constants
+        /// (`div`, e.g. bytes to kilobytes) multiply the magnitude by a magic reciprocal on AVX-512;
+        /// conversions by a ratio like 125/128 and unsigned divisions stay on the scalar path.
+        template <typename TFrom, typename TTo>
+        struct cast_traits {
+        private:
+            using TRep = typename TFrom::rep;
+            using TDivide = std::ratio_divide<typename TFrom::ratio, typename TTo::ratio>;
+            using TCommonRep = std::common_type_t<typename TTo::rep, TRep, std::int64_t>;
+
+            static constexpr bool kEligible = std::is_same_v<TRep, typename TTo::rep> &&
+                                              std::is_same_v<TRep, TCommonRep> && std::is_integral_v<TRep> &&
+                                              sizeof(TRep) == 8 && sizeof(TFrom) == sizeof(TRep) &&
+                                              sizeof(TTo) == sizeof(TRep);
+            static constexpr bool kFloatToInt =
+                std::is_same_v<TRep, double> && std::is_same_v<TCommonRep, double> &&
+                std::is_integral_v<typename TTo::rep> && std::is_signed_v<typename TTo::rep> &&
+                sizeof(typename TTo::rep) == 8 && sizeof(TFrom) == sizeof(TRep) &&
+                sizeof(TTo) == sizeof(TRep);
+
+            static constexpr auto kDen = static_cast<std::uint64_t>(TDivide::den);
+
+        public:
+            static constexpr cast_op op = kFloatToInt                                     ? cast_op::cvt
+                                          : !kEligible                                    ? cast_op::scalar
+                                          : (TDivide::num == 1 && TDivide::den == 1)      ? cast_op::copy
+                                          : (TDivide::den == 1 && log2(TDivide::num) > 0) ? cast_op::shl
+                                          : (TDivide::num == 1 && log2(TDivide::den) > 0) ? cast_op::shr
+                                          : (TDivide::den == 1)                           ? cast_op::mul
+                                          : (TDivide::num == 1 && std::is_signed_v<TRep>) ? cast_op::div
+                                                                                          : cast_op::scalar;
+            static constexpr int shift = op == cast_op::shl   ? log2(TDivide::num)
+                                         : op == cast_op::shr ? log2(TDivide::den)
+                                         : op == cast_op::div ? floor_log2(kDen)
+                                                              : 0;
+            static constexpr std::int64_t factor = TDivide::num;
+            static constexpr std::uint64_t magic = op == cast_op::div ? magic_reciprocal(kDen) : 0;
+            static constexpr bool is_signed = std::is_signed_v<TRep>;
+            // `cvt` scales by the same double constants as the scalar `unit_cast`
+            static constexpr double num = static_cast<double>(TDivide::num);
+            static constexpr double den = static_cast<double>(TDivide::den);
+        };
+
+#if PROX_DIGITAL_X86_DISPATCH
+        // High halves of the unsigned 64x64-bit products of each lane, out of 32x32 -> 64 partial products
+        [[gnu::target("avx512f,avx512dq")]] inline __m512i mulhi_epu64_avx512(__m512i a, __m512i b) {
+            const __m512i lowMask = _mm512_set1_epi64(0xffffffff);
+            const __m512i aHi = _mm512_srli_epi64(a, 32);
+            const __m512i bHi = _mm512_srli_epi64(b, 32);
+            const __m512i lh = _mm512_mul_epu32(a, bHi);
+            const __m512i hl = _mm512_mul_epu32(aHi, b);
+            const __m512i ll = _mm512_mul_epu32(a, b);
+            const __m512i mid = _mm512_add_epi64(
+                _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_and_si512(lh, lowMask)),
+                _mm512_and_si512(hl, lowMask)
+            );
+            return _mm512_add_epi64(
+                _mm512_add_epi64(_mm512_mul_epu32(aHi, bHi), _mm512_srli_epi64(lh, 32)),
+                _mm512_add_epi64(_mm512_srli_epi64(hl, 32), _mm512_srli_epi64(mid, 32))
+            );
+        }
+
+        template <typename TTraits>
+        inline std::size_t cast_sse2(const void* in, void* out, std::size_t n) {
+            constexpr int kShift = TTraits::shift;
+            const auto* src = static_cast<const __m128i_u*>(in);
+            auto* dst = static_cast<__m128i_u*>(out);
+            const std::size_t blocks = n / 2;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                __m128i x = _mm_loadu_si128(src + i);
+                if constexpr (TTraits::op == cast_op::shl) {
+                    x = _mm_slli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::shr && TTraits::is_signed) {
+                    // truncate towards zero: bias negative values by (2^k - 1) before shifting
+                    const __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                    x = _mm_add_epi64(x, _mm_srli_epi64(sign, 64 - kShift));
+                    const __m128i biasedSign =
+                        _mm_shuffle_epi32(_mm_srai_epi32(x, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                    x = _mm_xor_si128(_mm_srli_epi64(_mm_xor_si128(x, biasedSign), kShift), biasedSign);
+                } else if constexpr (TTraits::op == cast_op::shr) {
+                    x = _mm_srli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::mul) {
+                    // 64x64 -> low 64 multiply out of 32x32 -> 64 partial products
+                    const __m128i c = _mm_set1_epi64x(TTraits::factor);
+                    const __m128i lo = _mm_mul_epu32(x, c);
+                    __m128i cross = _mm_mul_epu32(_mm_srli_epi64(x, 32), c);
+                    if constexpr ((static_cast<std::uint64_t>(TTraits::factor) >> 32) != 0) {
+                        cross = _mm_add_epi64(cross, _mm_mul_epu32(x, _mm_srli_epi64(c, 32)));
+                    }
+                    x = _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+                }
+                _mm_storeu_si128(dst + i, x);
+            }
+            return blocks * 2;
+        }
+
+        /// Scaled and truncated doubles below 2^51 in magnitude convert exactly through the low bits of
+        /// `x + 1.5 * 2^52`. Stops at the first block holding a larger value (or NaN) and leaves the
+        /// rest to the scalar conversion.
+        template <typename TTraits>
+        [[gnu::target("avx2")]] inline std::size_t cvt_avx2(const void* in, void* out, std::size_t n) {
+            const auto* src = static_cast<const double*>(in);
+            auto* dst = static_cast<__m256i_u*>(out);
+            const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+            const __m256d limit = _mm256_set1_pd(2251799813685248.0);
+            const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffff));
+            const std::size_t blocks = n / 4;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                __m256d x = _mm256_loadu_pd(src + i * 4);
+                if constexpr (TTraits::num != 1.0) {
+                    x = _mm256_mul_pd(x, _mm256_set1_pd(TTraits::num));
+                }
+                if constexpr (TTraits::den != 1.0) {
+                    x = _mm256_div_pd(x, _mm256_set1_pd(TTraits::den));
+                }
+                x = _mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_and_pd(x, absMask), limit, _CMP_LT_OQ)) != 0xf) {
+                    return i * 4;
+                }
+                _mm256_storeu_si256(
+                    dst + i,
+                    _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(x, magic)), _mm256_castpd_si256(magic))
+                );
+            }
+            return blocks * 4;
+        }
+
+        template <typename TTraits>
+        [[gnu::target("avx2")]] inline std::size_t cast_avx2(const void* in, void* out, std::size_t n) {
+            constexpr int kShift = TTraits::shift;
+            const auto* src = static_cast<const __m256i_u*>(in);
+            auto* dst = static_cast<__m256i_u*>(out);
+            const std::size_t blocks = n / 4;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                __m256i x = _mm256_loadu_si256(src + i);
+                if constexpr (TTraits::op == cast_op::shl) {
+                    x = _mm256_slli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::shr && TTraits::is_signed) {
+                    const __m256i zero = _mm256_setzero_si256();
+                    x = _mm256_add_epi64(x, _mm256_srli_epi64(_mm256_cmpgt_epi64(zero, x), 64 - kShift));
+                    const __m256i biasedSign = _mm256_cmpgt_epi64(zero, x);
+                    x = _mm256_xor_si256(
+                        _mm256_srli_epi64(_mm256_xor_si256(x, biasedSign), kShift), biasedSign
+                    );
+                } else if constexpr (TTraits::op == cast_op::shr) {
+                    x = _mm256_srli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::mul) {
+                    const __m256i c = _mm256_set1_epi64x(TTraits::factor);
+                    const __m256i lo = _mm256_mul_epu32(x, c);
+                    __m256i cross = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), c);
+                    if constexpr ((static_cast<std::uint64_t>(TTraits::factor) >> 32) != 0) {
+                        cross = _mm256_add_epi64(cross, _mm256_mul_epu32(x, _mm256_srli_epi64(c, 32)));
+                    }
+                    x = _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+                }
+                _mm256_storeu_si256(dst + i, x);
+            }
+            return blocks * 4;
+        }
+
+        template <typename TTraits>
+        [[gnu::target("avx512f,avx512dq")]] inline std::size_t
+        cast_avx512(const void* in, void* out, std::size_t n) {
+            constexpr unsigned kShift = TTraits::shift;
+            const auto* src = static_cast<const __m512i_u*>(in);
+            auto* dst = static_cast<__m512i_u*>(out);
+            const std::size_t blocks = n / 8;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                __m512i x = _mm512_loadu_si512(src + i);
+                if constexpr (TTraits::op == cast_op::shl) {
+                    x = _mm512_slli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::shr && TTraits::is_signed) {
+                    x = _mm512_add_epi64(x, _mm512_srli_epi64(_mm512_srai_epi64(x, 63), 64 - kShift));
+                    x = _mm512_srai_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::shr) {
+                    x = _mm512_srli_epi64(x, kShift);
+                } else if constexpr (TTraits::op == cast_op::mul) {
+                    x = _mm512_mullo_epi64(x, _mm512_set1_epi64(TTraits::factor));
+                } else if constexpr (TTraits::op == cast_op::div) {
+                    const __m512i sign = _mm512_srai_epi64(x, 63);
+                    const __m512i magic = _mm512_set1_epi64(static_cast<long long>(TTraits::magic));
+                    const __m512i magnitude = _mm512_abs_epi64(x);
+                    const __m512i quot = _mm512_srli_epi64(mulhi_epu64_avx512(magnitude, magic), kShift);
+                    x = _mm512_sub_epi64(_mm512_xor_si512(quot, sign), sign);
+                }
+                _mm512_storeu_si512(dst + i, x);
+            }
+            return blocks * 8;
+        }
+
+        template <typename TTraits>
+        [[gnu::target("avx512f,avx512dq")]] inline std::size_t
+        cvt_avx512(const void* in, void* out, std::size_t n) {
+            const auto* src = static_cast<const double*>(in);
+            auto* dst = static_cast<__m512i_u*>(out);
+            const std::size_t blocks = n / 8;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                __m512d x = _mm512_loadu_pd(src + i * 8);
+                if constexpr (TTraits::num != 1.0) {
+                    x = _mm512_mul_pd(x, _mm512_set1_pd(TTraits::num));
+                }
+                if constexpr (TTraits::den != 1.0) {
+                    x = _mm512_div_pd(x, _mm512_set1_pd(TTraits::den));
+                }
+                _mm512_storeu_si512(dst + i, _mm512_cvttpd_epi64(x));
+            }
+            return blocks * 8;
+        }
+#endif
+
+        template <typename TTo, typename TFrom>
+        TTo* cast(isa level, const TFrom* first, const TFrom* last, TTo* out) {
+            using TTraits = cast_traits<TFrom, TTo>;
+            const auto n = static_cast<std::size_t>(last - first);
+            std::size_t done = 0;
+#if PROX_DIGITAL_X86_DISPATCH
+            if constexpr (TTraits::op == cast_op::cvt) {
+                // SSE2 has no packed double -> int64 conversion
+                if (level == isa::avx512) {
+                    done = cvt_avx512<TTraits>(first, out, n);
+                } else if (level == isa::avx2) {
+                    done = cvt_avx2<TTraits>(first, out, n);
+                }
+            } else if constexpr (TTraits::op == cast_op::div) {
+                // narrower emulated multiply-highs lose to the compiler's scalar one
+                if (level == isa::avx512) {
+                    done = cast_avx512<TTraits>(first, out, n);
+                }
+            } else if constexpr (TTraits::op != cast_op::scalar) {
+                if (level == isa::avx512) {
+                    done = cast_avx512<TTraits>(first, out, n);
+                } else if (level == isa::avx2) {
+                    done = cast_avx2<TTraits>(first, out, n);
+                } else if (level == isa::sse2) {
+                    done = cast_sse2<TTraits>(first, out, n);
+                }
+            }
+#else
+            static_cast<void>(level);
+#endif
+            for (std::size_t i = done; i < n; ++i) {
+                out[i] = PROX_DIGITAL_NAMESPACE_NAME::unit_cast<TTo>(first[i]);
+            }
+            return out + n;
+        }
+
+        /// Running integral sum together with the net number of times it wrapped around.
+        /// The wrapped total is the exact sum whenever the net count is zero.
+        template <typename TRep>
+        struct accumulator {
+            TRep total{};
+            std::int64_t wraps = 0;
+
+            constexpr void add(TRep x) {
+                using TUnsigned = std::make_unsigned_t<TRep>;
+                const auto next = static_cast<TRep>(static_cast<TUnsigned>(total) + static_cast<TUnsigned>(x));
+                if constexpr (std::is_signed_v<TRep>) {
+                    if (((total ^ next) & (x ^ next)) < 0) {
+                        wraps += x < 0 ? -1 : 1;
+                    }
+                } else if (next < x) {
+                    ++wraps;
+                }
+                total = next;
+            }
+        };
+
+        /// Neumaier's compensated summation for floating-point reps
+        template <typename TRep>
+        struct compensated_accumulator {
+            TRep total{};
+            TRep compensation{};
+
+            constexpr void add(TRep x) {
+                const TRep next = total + x;
+                if ((total < 0 ? -total : total) >= (x < 0 ? -x : x)) {
+                    compensation += (total - next) + x;
+                } else {
+                    compensation += (x - next) + total;
+                }
+                total = next;
+            }
+
+            constexpr TRep result() const { return total + compensation; }
+        };
+
+        template <typename TUnit>
+        inline constexpr bool is_simd_i64_v =
+            std::is_same_v<typename TUnit::rep, std::int64_t> && sizeof(TUnit) == sizeof(std::int64_t);
+
+#if PROX_DIGITAL_X86_DISPATCH
+        inline std::size_t sum_sse2(const void* in, std::size_t n, accumulator<std::int64_t>& acc) {
+            const auto* src = static_cast<const __m128i_u*>(in);
+            const std::size_t blocks = n / 2;
+            const __m128i one = _mm_set1_epi64x(1);
+            const auto sign = [](__m128i v) {
+                return _mm_shuffle_epi32(_mm_srai_epi32(v, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            };
+            __m128i total = _mm_setzero_si128();
+            __m128i wraps = _mm_setzero_si128();
+            for (std::size_t i = 0; i < blocks; ++i) {
+                const __m128i x = _mm_loadu_si128(src + i);
+                const __m128i next = _mm_add_epi64(total, x);
+                const __m128i wrapped = sign(_mm_and_si128(_mm_xor_si128(total, next), _mm_xor_si128(x, next)));
+                wraps = _mm_add_epi64(wraps, _mm_and_si128(wrapped, _mm_or_si128(sign(x), one)));
+                total = next;
+            }
+            std::int64_t totals[2];
+            std::int64_t laneWraps[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i_u*>(totals), total);
+            _mm_storeu_si128(reinterpret_cast<__m128i_u*>(laneWraps), wraps);
+            for (std::size_t lane = 0; lane < 2; ++lane) {
+                acc.add(totals[lane]);
+                acc.wraps += laneWraps[lane];
+            }
+            return blocks * 2;
+        }
+
+        [[gnu::target("avx2")]] inline std::size_t
+        sum_avx2(const void* in, std::size_t n, accumulator<std::int64_t>& acc) {
+            const auto* src = static_cast<const __m256i_u*>(in);
+            const std::size_t blocks = n / 4;
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i one = _mm256_set1_epi64x(1);
+            __m256i total = zero;
+            __m256i wraps = zero;
+            for (std::size_t i = 0; i < blocks; ++i) {
+                const __m256i x = _mm256_loadu_si256(src + i);
+                const __m256i next = _mm256_add_epi64(total, x);
+                const __m256i wrapped = _mm256_cmpgt_epi64(
+                    zero, _mm256_and_si256(_mm256_xor_si256(total, next), _mm256_xor_si256(x, next))
+                );
+                const __m256i direction = _mm256_or_si256(_mm256_cmpgt_epi64(zero, x), one);
+                wraps = _mm256_add_epi64(wraps, _mm256_and_si256(wrapped, direction));
+                total = next;
+            }
+            std::int64_t totals[4];
+            std::int64_t laneWraps[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i_u*>(totals), total);
+            _mm256_storeu_si256(reinterpret_cast<__m256i_u*>(laneWraps), wraps);
+            for (std::size_t lane = 0; lane < 4; ++lane) {
+                acc.add(totals[lane]);
+                acc.wraps += laneWraps[lane];
+            }
+            return blocks * 4;
+        }
+
+        [[gnu::target("avx512f,avx512dq")]] inline std::size_t
+        sum_avx512(const void* in, std::size_t n, accumulator<std::int64_t>& acc) {
+            const auto* src = static_cast<const __m512i_u*>(in);
+            const std::size_t blocks = n / 8;
+            const __m512i one = _mm512_set1_epi64(1);
+            __m512i total = _mm512_setzero_si512();
+            __m512i wraps = _mm512_setzero_si512();
+            for (std::size_t i = 0; i < blocks; ++i) {
+                const __m512i x = _mm512_loadu_si512(src + i);
+                const __m512i next = _mm512_add_epi64(total, x);
+                const __m512i wrapped = _mm512_srai_epi64(
+                    _mm512_and_si512(_mm512_xor_si512(total, next), _mm512_xor_si512(x, next)), 63
+                );
+                const __m512i direction = _mm512_or_si512(_mm512_srai_epi64(x, 63), one);
+                wraps = _mm512_add_epi64(wraps, _mm512_and_si512(wrapped, direction));
+                total = next;
+            }
+            std::int64_t totals[8];
+            std::int64_t laneWraps[8];
+            _mm512_storeu_si512(totals, total);
+            _mm512_storeu_si512(laneWraps, wraps);
+            for (std::size_t lane = 0; lane < 8; ++lane) {
+                acc.add(totals[lane]);
+                acc.wraps += laneWraps[lane];
+            }
+            return blocks * 8;
+        }
+
+        [[gnu::target("avx2")]] inline std::size_t
+        minmax_avx2(const void* in, std::size_t n, std::int64_t& lo, std::int64_t& hi) {
+            const auto* src = static_cast<const __m256i_u*>(in);
+            const std::size_t blocks = n / 4;
+            __m256i vlo = _mm256_set1_epi64x(lo);
+            __m256i vhi = _mm256_set1_epi64x(hi);
+            for (std::size_t i = 0; i < blocks; ++i) {
+                const __m256i x = _mm256_loadu_si256(src + i);
+                vlo = _mm256_blendv_epi8(vlo, x, _mm256_cmpgt_epi64(vlo, x));
+                vhi = _mm256_blendv_epi8(vhi, x, _mm256_cmpgt_epi64(x, vhi));
+            }
+            std::int64_t los[4];
+            std::int64_t his[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i_u*>(los), vlo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i_u*>(his), vhi);
+            for (std::size_t lane = 0; lane < 4; ++lane) {
+                lo = los[lane] < lo ? los[lane] : lo;
+                hi = his[lane] > hi ? his[lane] : hi;
+            }
+            return blocks * 4;
+        }
+
+        [[gnu::target("avx512f")]] inline std::size_t
+        minmax_avx512(const void* in, std::size_t n, std::int64_t& lo, std::int64_t& hi) {
+            const auto* src = static_cast<const __m512i_u*>(in);
+            const std::size_t blocks = n / 8;
+            __m512i vlo = _mm512_set1_epi64(lo);
+            __m512i vhi = _mm512_set1_epi64(hi);
+            for (std::size_t i = 0; i < blocks; ++i) {
+                const __m512i x = _mm512_loadu_si512(src + i);
+                vlo = _mm512_min_epi64(vlo, x);
+                vhi = _mm512_max_epi64(vhi, x);
+            }
+            lo = _mm512_reduce_min_epi64(vlo);
+            hi = _mm512_reduce_max_epi64(vhi);
+            return blocks * 8;
+        }
+#endif
+
+        template <typename TUnit>
+        void sum_block(isa level, const TUnit* first, std::size_t n, accumulator<std::int64_t>& acc) {
+            std::size_t done = 0;
+#if PROX_DIGITAL_X86_DISPATCH
+            if (level == isa::avx512) {
+                done = sum_avx512(first, n, acc);
+            } else if (level == isa::avx2) {
+                done = sum_avx2(first, n, acc);
+            } else if (level == isa::sse2) {
+                done = sum_sse2(first, n, acc);
+            }
+#else
+            static_cast<void>(level);
+#endif
+            for (std::size_t i = done; i < n; ++i) {
+                acc.add(first[i].value());
+            }
+        }
+
+        /// Sign and magnitude of the exact integral sum of [first, last), which needs up to 128 bits
+        template <typename TFrom>
+        std::pair<bool, wide::uint128> exact_sum(isa level, const TFrom* first, const TFrom* last) {
+            using TRep = typename TFrom::rep;
+            if constexpr (std::is_signed_v<TRep>) {
+                accumulator<std::int64_t> acc;
+                if constexpr (is_simd_i64_v<TFrom>) {
+                    sum_block(level, first, static_cast<std::size_t>(last - first), acc);
+                } else {
+                    static_cast<void>(level);
+                    for (; first != last; ++first) {
+                        acc.add(static_cast<std::int64_t>(first->value()));
+                    }
+                }
+                // total + wraps * 2^64 in two's complement
+                const std::uint64_t hi = static_cast<std::uint64_t>(acc.wraps) - (acc.total < 0 ? 1U : 0U);
+                const auto lo = static_cast<std::uint64_t>(acc.total);
+                if ((hi >> 63) == 0) {
+                    return { false, { hi, lo } };
+                }
+                return { true, { ~hi + (lo == 0 ? 1U : 0U), 0U - lo } };
+            } else {
+                static_cast<void>(level);
+                accumulator<std::uint64_t> acc;
+                for (; first != last; ++first) {
+                    acc.add(static_cast<std::uint64_t>(first->value()));
+                }
+                return { false, { static_cast<std::uint64_t>(acc.wraps), acc.total } };
+            }
+        }
+
+        template <typename TTo, typename TFrom>
+        sum_result<TTo> sum(isa level, const TFrom* first, const TFrom* last) {
+            using result = sum_result<TTo>;
+            using TRep = typename TTo::rep;
+            using TFromRep = typename TFrom::rep;
+            if constexpr (std::is_floating_point_v<TRep>) {
+                compensated_accumulator<TRep> acc;
+                for (; first != last; ++first) {
+                    acc.add(PROX_DIGITAL_NAMESPACE_NAME::unit_cast<TTo>(*first).value());
+                }
+                const TRep total = acc.result();
+                return result{ TTo(total), std::isinf(total) };
+            } else if constexpr (is_simd_i64_v<TTo> && std::is_same_v<TFrom, TTo>) {
+                accumulator<std::int64_t> acc;
+                sum_block(level, first, static_cast<std::size_t>(last - first), acc);
+                return result{ TTo(acc.total), acc.wraps != 0 };
+            } else if constexpr (std::is_floating_point_v<TFromRep>) {
+                // sum in the source rep and truncate only the total
+                const TFromRep total = sum<TFrom>(level, first, last).value.value();
+                const long double converted = std::trunc(
+                    PROX_DIGITAL_NAMESPACE_NAME::unit_cast<unit<long double, typename TTo::ratio>>(
+                        unit<long double, typename TFrom::ratio>(total)
+                    )
+                        .value()
+                );
+                const auto lo = static_cast<long double>(std::numeric_limits<TRep>::min());
+                const long double hi = std::ldexp(1.0L, std::numeric_limits<TRep>::digits);
+                const bool fits = converted >= lo && converted < hi;
+                return result{ TTo(fits ? static_cast<TRep>(converted) : TRep{}), !fits };
+            } else if constexpr (sizeof(TFromRep) <= sizeof(std::uint64_t) &&
+                                 sizeof(TRep) <= sizeof(std::uint64_t)) {
+                static_assert(
+                    is_integral_rep_v<TFromRep> && is_integral_rep_v<TRep>, "Unsupported representation"
+                );
+                // sum exactly in the source unit, then convert the total once
+                using TDivide = std::ratio_divide<typename TFrom::ratio, typename TTo::ratio>;
+                constexpr auto kNum = static_cast<std::uint64_t>(TDivide::num);
+                constexpr auto kDen = static_cast<std::uint64_t>(TDivide::den);
+                constexpr wide::divider kDivider = wide::make_divider(kDen);
+                const auto [negative, magnitude] = exact_sum(level, first, last);
+                const wide::checked scaled = wide::mul_div(magnitude, kNum, kDen, kDivider);
+                using TUnsigned = std::make_unsigned_t<TRep>;
+                const auto max = static_cast<std::uint64_t>(std::numeric_limits<TRep>::max());
+                const std::uint64_t limit = !negative ? max : std::is_signed_v<TRep> ? max + 1 : 0;
+                const auto bits = static_cast<TUnsigned>(negative ? 0U - scaled.value : scaled.value);
+                return result{ TTo(static_cast<TRep>(bits)), !scaled.fits || scaled.value > limit };
+            } else {
+                static_assert(
+                    is_integral_rep_v<TFromRep> && is_integral_rep_v<TRep>, "Unsupported representation"
+                );
+#if defined(__SIZEOF_INT128__)
+                // 128-bit reps: sum exactly in the source unit, counting the 128-bit wraps, then scale the
+                // 192-bit magnitude into the target as value / den * num + value % den * num / den
+                using TWide = typename wide::int128<TFromRep>::type;
+                using TDivide = std::ratio_divide<typename TFrom::ratio, typename TTo::ratio>;
+                constexpr auto kNum = static_cast<std::uint64_t>(TDivide::num);
+                constexpr auto kDen = static_cast<std::uint64_t>(TDivide::den);
+                TWide running{};
+                std::int64_t wraps = 0;
+                for (; first != last; ++first) {
+                    const auto v = static_cast<TWide>(first->value());
+                    if (__builtin_add_overflow(running, v, &running)) {
+                        if constexpr (std::numeric_limits<TWide>::is_signed) {
+                            wraps += v < 0 ? -1 : 1;
+                        } else {
+                            ++wraps;
+                        }
+                    }
+                }
+                // the total is wraps * 2^128 + running, held as a two's complement 192-bit value
+                const auto bits = static_cast<uint128_t>(running);
+                std::int64_t high = wraps;
+                if constexpr (std::numeric_limits<TWide>::is_signed) {
+                    high -= running < 0 ? 1 : 0;
+                }
+                const bool negative = high < 0;
+                wide::uint192 whole{ static_cast<std::uint64_t>(high), bits };
+                if (negative) {
+                    const std::uint64_t borrow = bits != 0 ? 1U : 0U;
+                    whole = { 0U - static_cast<std::uint64_t>(high) - borrow, uint128_t{ 0 } - bits };
+                }
+                const std::uint64_t rem = wide::divmod(whole, kDen);
+                const wide::uint192 scaled = wide::mul(whole.lo, kNum);
+                // rem < den, so the quotient of the remainder is below num
+                const uint128_t magnitude = scaled.lo + static_cast<uint128_t>(rem) * kNum / kDen;
+                const auto max = static_cast<uint128_t>(std::numeric_limits<TRep>::max());
+                const uint128_t limit = !negative ? max : std::numeric_limits<TRep>::is_signed ? max + 1 : 0;
+                const bool fits =
+                    whole.hi == 0 && scaled.hi == 0 && magnitude >= scaled.lo && magnitude <= limit;
+                const uint128_t total = negative ? uint128_t{ 0 } - magnitude : magnitude;
+                return result{ TTo(static_cast<TRep>(total)), !fits };
+#endif
+            }
+        }
+
+        template <typename TUnit>
+        std::pair<TUnit, TUnit> minmax(isa level, const TUnit* first, const TUnit* last) {
+            auto lo = TUnit::max();
+            auto hi = TUnit::min();
+            std::size_t done = 0;
+            const auto n = static_cast<std::size_t>(last - first);
+#if PROX_DIGITAL_X86_DISPATCH
+            if constexpr (is_simd_i64_v<TUnit>) {
+                std::int64_t vlo = lo.value();
+                std::int64_t vhi = hi.value();
+                if (level == isa::avx512) {
+                    done = minmax_avx512(first, n, vlo, vhi);
+                } else if (level == isa::avx2) {
+                    done = minmax_avx2(first, n, vlo, vhi);
+                }
+                lo = TUnit(vlo);
+                hi = TUnit(vhi);
+            }
+#else
+            static_cast<void>(level);
+#endif
+            for (std::size_t i = done; i < n; ++i) {
+                lo = first[i].value() < lo.value() ? first[i] : lo;
+                hi = first[i].value() > hi.value() ? first[i] : hi;
+            }
+            return { lo, hi };
+        }
+    } // namespace bulk
+} // namespace detail
+
+/// Converts every unit in [first, last) to `TTo` and writes the results starting at `out`.
+/// Equivalent to calling `unit_cast<TTo>` per element, but uses SIMD kernels selected at runtime.
+/// Returns the iterator past the last element written.
+template <typename TTo, typename TRep, typename TRatio>
+auto unit_cast(const unit<TRep, TRatio>* first, const unit<TRep, TRatio>* last, TTo* out)
+    -> std::enable_if_t<detail::is_specialization_of_v<TTo, unit>, TTo*> {
+    return detail::bulk::cast(detail::bulk::detect_isa(), first, last, out);
+}
+
+/// Sums [first, last) in the input unit, or in `TTo` when given. Integral sums are exact in the input unit
+/// and converted to `TTo` once, truncating the total like `unit_cast`; `overflow` reports exactly whether
+/// that total exceeds `TTo` - intermediate wrap-arounds that cancel out do not count. Floating-point sums
+/// use compensated summation.
+template <typename TTo = void, typename TRep, typename TRatio>
+auto sum(const unit<TRep, TRatio>* first, const unit<TRep, TRatio>* last)
+    -> sum_result<std::conditional_t<std::is_void_v<TTo>, unit<TRep, TRatio>, TTo>> {
+    using TResult = std::conditional_t<std::is_void_v<TTo>, unit<TRep, TRatio>, TTo>;
+    return detail::bulk::sum<TResult>(detail::bulk::detect_isa(), first, last);
+}
+
+/// Returns the first smallest unit in [first, last), or `last` if the range is empty
+template <typename TRep, typename TRatio>
+const unit<TRep, TRatio>* min_element(const unit<TRep, TRatio>* first, const unit<TRep, TRatio>* last) {
+    const auto lo = detail::bulk::minmax(detail::bulk::detect_isa(), first, last).first.value();
+    for (; first != last && first->value() != lo; ++first) {
+    }
+    return first;
+}
+
+/// Returns the first largest unit in [first, last), or `last` if the range is empty
+template <typename TRep, typename TRatio>
+const unit<TRep, TRatio>* max_element(const unit<TRep, TRatio>* first, const unit<TRep, TRatio>* last) {
+    const auto hi = detail::bulk::minmax(detail::bulk::detect_isa(), first, last).second.value();
+    for (; first != last && first->value() != hi; ++first) {
+    }
+    return first;
+}
+
+/// Returns the smallest and the largest unit in [first, last).
+/// An empty range yields `{ unit::max(), unit::min() }`.
+template <typename TRep, typename TRatio>
+std::pair<unit<TRep, TRatio>, unit<TRep, TRatio>> minmax(
+    const unit<TRep, TRatio>* first,
+    const unit<TRep, TRatio>* last
+) {
+    return detail::bulk::minmax(detail::bulk::detect_isa(), first, last);
+}
+
+#if defined(__cpp_lib_span)
+/// Converts `in` element-wise into the front of `out`, which must be at least as large as `in`
+/// (`std::invalid_argument` otherwise). Returns the written part of `out`.
+template <typename TTo, typename TFrom, std::size_t TExtent1, std::size_t TExtent2>
+auto unit_cast(std::span<TFrom, TExtent1> in, std::span<TTo, TExtent2> out) -> std::enable_if_t<
+    detail::is_specialization_of_v<std::remove_const_t<TFrom>, unit> &&
+        detail::is_specialization_of_v<TTo, unit>,
+    std::span<TTo>> {
+    if (out.size() < in.size()) {
+        throw std::invalid_argument("the output span is smaller than the input");
+    }
+    const auto* first = in.data();
+    unit_cast<TTo>(first, first + in.size(), out.data());
+    return out.first(in.size());
+}
+
+template <typename TTo = void, typename TFrom, std::size_t TExtent>
+auto sum(std::span<TFrom, TExtent> in) {
+    const TFrom* first = in.data();
+    return sum<TTo>(first, first + in.size());
+}
+
+template <typename TFrom, std::size_t TExtent>
+auto min_element(std::span<TFrom, TExtent> in) {
+    const TFrom* first = in.data();
+    return in.begin() + (min_element(first, first + in.size()) - first);
+}
+
+template <typename TFrom, std::size_t TExtent>
+auto max_element(std::span<TFrom, TExtent> in) {
+    const TFrom* first = in.data();
+    return in.begin() + (max_element(first, first + in.size()) - first);
+}
+
+template <typename TFrom, std::size_t TExtent>
+auto minmax(std::span<TFrom, TExtent> in) {
+    const TFrom* first = in.data();
+    return minmax(first, first + in.size());
+}
+#endif
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_BULK_HPP_
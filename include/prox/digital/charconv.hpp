@@ -0,0 +1,910 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_CHARCONV_HPP_
+#define PROX_DIGITAL_CHARCONV_HPP_
+
+#include <prox/digital.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Options controlling which spellings `from_chars` accepts
+struct parse_options {
+    /// Accept suffixes in any case ("gib", "Kb"); otherwise only "B", "kB"/"KB", "MB", ..., "KiB", "MiB", ...
+    /// A lowercase "e" is only taken for exa when followed by "B" or "iB".
+    bool case_insensitive = true;
+    /// Accept blanks between the number and the suffix ("5.5 GiB")
+    bool allow_space = true;
+    /// Interpret bare prefixes without a "B" ("512k", "10M") as binary multiples, like dd or sort do
+    bool binary_bare_prefix = false;
+};
+
+namespace detail {
+    namespace charconv {
+        inline constexpr int kMaxDigits = 19;
+
+        inline constexpr std::uint64_t kPow10[kMaxDigits + 1] = { 1ULL,
+                                                                  10ULL,
+                                                                  100ULL,
+                                                                  1000ULL,
+                                                                  10000ULL,
+                                                                  100000ULL,
+                                                                  1000000ULL,
+                                                                  10000000ULL,
+                                                                  100000000ULL,
+                                                                  1000000000ULL,
+                                                                  10000000000ULL,
+                                                                  100000000000ULL,
+                                                                  1000000000000ULL,
+                                                                  10000000000000ULL,
+                                                                  100000000000000ULL,
+                                                                  1000000000000000ULL,
+                                                                  10000000000000000ULL,
+                                                                  100000000000000000ULL,
+                                                                  1000000000000000000ULL,
+                                                                  10000000000000000000ULL };
+
+        /// Size of each suffix in bytes, indexed by [binary][prefix] where prefix 0 is "B"
+        inline constexpr std::uint64_t kPrefixes[2][7] = {
+            { 1ULL, kPow10[3], kPow10[6], kPow10[9], kPow10[12], kPow10[15], kPow10[18] },
+            { 1ULL, 1ULL << 10, 1ULL << 20, 1ULL << 30, 1ULL << 40, 1ULL << 50, 1ULL << 60 },
+        };
+
+        /// Scale of a suffix relative to the target ratio, as a reduced fraction; `den == 0` when
+        /// the numerator does not fit (a suffix worth more than 2^64 target units)
+        struct scale {
+            std::uint64_t num;
+            std::uint64_t den;
+        };
+
+        /// Computed from the suffix size instead of through std::ratio_divide, which fails to compile
+        /// for the suffixes that overflow a fine-grained target such as std::ratio<1, 100>
+        template <typename TTo>
+        constexpr scale make_scale(std::uint64_t from) {
+            static_assert(TTo::num > 0 && TTo::den > 0, "Ratio must be positive");
+            const auto toNum = static_cast<std::uint64_t>(TTo::num);
+            const auto toDen = static_cast<std::uint64_t>(TTo::den);
+            const std::uint64_t g = std::gcd(from, toNum);
+            const std::uint64_t num = from / g;
+            if (num > std::numeric_limits<std::uint64_t>::max() / toDen) {
+                return { 0, 0 };
+            }
+            return { num * toDen, toNum / g };
+        }
+
+        /// Suffix scales for a target ratio, indexed like `kPrefixes`
+        template <typename TRatio>
+        inline constexpr scale kScales[2][7] = {
+            { make_scale<TRatio>(kPrefixes[0][0]),
+              make_scale<TRatio>(kPrefixes[0][1]),
+              make_scale<TRatio>(kPrefixes[0][2]),
+              make_scale<TRatio>(kPrefixes[0][3]),
+              make_scale<TRatio>(kPrefixes[0][4]),
+              make_scale<TRatio>(kPrefixes[0][5]),
+              make_scale<TRatio>(kPrefixes[0][6]) },
+            { make_scale<TRatio>(kPrefixes[1][0]),
+              make_scale<TRatio>(kPrefixes[1][1]),
+              make_scale<TRatio>(kPrefixes[1][2]),
+              make_scale<TRatio>(kPrefixes[1][3]),
+              make_scale<TRatio>(kPrefixes[1][4]),
+              make_scale<TRatio>(kPrefixes[1][5]),
+              make_scale<TRatio>(kPrefixes[1][6]) },
+        };
+
+        constexpr int prefix_index(char c, bool caseInsensitive) {
+            switch (c) {
+            case 'k':
+            case 'K':
+                return 1;
+            case 'M':
+                return 2;
+            case 'G':
+                return 3;
+            case 'T':
+                return 4;
+            case 'P':
+                return 5;
+            case 'E':
+                return 6;
+            case 'm':
+                return caseInsensitive ? 2 : -1;
+            case 'g':
+                return caseInsensitive ? 3 : -1;
+            case 't':
+                return caseInsensitive ? 4 : -1;
+            case 'p':
+                return caseInsensitive ? 5 : -1;
+            case 'e':
+                return caseInsensitive ? 6 : -1;
+            default:
+                return -1;
+            }
+        }
+
+        struct suffix {
+            const char* ptr;
+            int prefix;
+            bool binary;
+        };
+
+        /// Parses an optional suffix starting at `first`, returns `ptr == first` if there is none
+        constexpr suffix parse_suffix(const char* first, const char* last, const parse_options& options) {
+            const auto is = [&](const char* p, char c) {
+                return p != last && (*p == c || (options.case_insensitive && (*p | 0x20) == (c | 0x20)));
+            };
+            // a suffix must not run into further letters or digits ("12 parsecs" and "5e3" have none)
+            const auto isEnd = [&](const char* p) {
+                const auto lower = static_cast<char>(p == last ? 0 : *p | 0x20);
+                return (lower < 'a' || lower > 'z') && (lower < '0' || lower > '9');
+            };
+            const char* p = first;
+            if (options.allow_space) {
+                while (p != last && (*p == ' ' || *p == '\t')) {
+                    ++p;
+                }
+            }
+            if (p == last) {
+                return { first, 0, false };
+            }
+            suffix res{ first, 0, false };
+            const int prefix = prefix_index(*p, options.case_insensitive);
+            if (prefix < 0) {
+                if (is(p, 'B')) {
+                    res = { p + 1, 0, false };
+                }
+            } else if (is(++p, 'i')) {
+                ++p;
+                res = { is(p, 'B') ? p + 1 : p, prefix, true };
+            } else if (is(p, 'B')) {
+                res = { p + 1, prefix, false };
+            } else if (p[-1] != 'e') {
+                // a bare lowercase "e" is more likely a truncated exponent ("5e") than exabytes
+                res = { p, prefix, options.binary_bare_prefix };
+            }
+            return isEnd(res.ptr) ? res : suffix{ first, 0, false };
+        }
+
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128 = unsigned __int128;
+
+        constexpr uint128 mul(std::uint64_t a, std::uint64_t b) {
+            return static_cast<uint128>(a) * b;
+        }
+
+        constexpr uint128 mul(uint128 a, std::uint64_t b) {
+            return a * b;
+        }
+
+        constexpr void divmod(uint128 n, uint128 d, uint128& quot, uint128& rem) {
+            quot = n / d;
+            rem = n % d;
+        }
+
+        constexpr bool fits64(uint128 v) {
+            return (v >> 64) == 0;
+        }
+
+        constexpr std::uint64_t low64(uint128 v) {
+            return static_cast<std::uint64_t>(v);
+        }
+
+        constexpr uint128 make128(std::uint64_t v) {
+            return v;
+        }
+
+        constexpr bool less(uint128 a, uint128 b) {
+            return a < b;
+        }
+
+        constexpr uint128 add(uint128 a, std::uint64_t b) {
+            return a + b;
+        }
+
+        constexpr bool is_zero(uint128 v) {
+            return v == 0;
+        }
+
+        // the integral part of a 128-bit rep written in a finer unit may need up to 192 bits
+        constexpr bool less(const wide::uint192& a, uint128 b) {
+            return a.hi == 0 && a.lo < b;
+        }
+
+        constexpr wide::uint192 add(wide::uint192 a, std::uint64_t b) {
+            a.lo += b;
+            a.hi += a.lo < b ? 1 : 0;
+            return a;
+        }
+
+        constexpr bool is_zero(const wide::uint192& v) {
+            return v.hi == 0 && v.lo == 0;
+        }
+#else
+        // the subset of 128-bit arithmetic needed here, for compilers without a native type
+        using uint128 = wide::uint128;
+
+        constexpr uint128 mul(std::uint64_t a, std::uint64_t b) {
+            return wide::mul(a, b);
+        }
+
+        constexpr uint128 mul(uint128 a, std::uint64_t b) {
+            const uint128 lo = wide::mul(a.lo, b);
+            return { lo.hi + a.hi * b, lo.lo };
+        }
+
+        constexpr bool fits64(uint128 v) {
+            return v.hi == 0;
+        }
+
+        constexpr std::uint64_t low64(uint128 v) {
+            return v.lo;
+        }
+
+        constexpr uint128 make128(std::uint64_t v) {
+            return { 0, v };
+        }
+
+        constexpr bool less(uint128 a, uint128 b) {
+            return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+        }
+
+        constexpr uint128 add(uint128 a, std::uint64_t b) {
+            return { a.hi + (a.lo + b < b ? 1 : 0), a.lo + b };
+        }
+
+        constexpr bool is_zero(uint128 v) {
+            return v.hi == 0 && v.lo == 0;
+        }
+
+        constexpr void divmod(uint128 n, uint128 d, uint128& quot, uint128& rem) {
+            // restoring long division
+            rem = { 0, 0 };
+            quot = { 0, 0 };
+            for (int bit = 127; bit >= 0; --bit) {
+                rem = { (rem.hi << 1) | (rem.lo >> 63), (rem.lo << 1) };
+                rem.lo |= bit >= 64 ? (n.hi >> (bit - 64)) & 1 : (n.lo >> bit) & 1;
+                if (!less(rem, d)) {
+                    const std::uint64_t borrow = rem.lo < d.lo ? 1 : 0;
+                    rem = { rem.hi - d.hi - borrow, rem.lo - d.lo };
+                    if (bit >= 64) {
+                        quot.hi |= 1ULL << (bit - 64);
+                    } else {
+                        quot.lo |= 1ULL << bit;
+                    }
+                }
+            }
+        }
+#endif
+    } // namespace charconv
+} // namespace detail
+
+/// Parses a size such as "512", "10MB", "5.5 GiB" or "512k" from [first, last) into `value`.
+/// Integral units are computed exactly from the decimal digits (truncating like `unit_cast` when the
+/// size is not a whole number of units); a missing suffix means bytes. Follows `std::from_chars`:
+/// on success `ec` is value-initialized and `ptr` points past the suffix, on failure `value` is
+/// left untouched and `ec` is `std::errc::invalid_argument` or `std::errc::result_out_of_range`
+/// (with `ptr` still past the number and its suffix).
+template <typename TRep, typename TRatio>
+constexpr std::from_chars_result from_chars(
+    const char* first,
+    const char* last,
+    unit<TRep, TRatio>& value,
+    const parse_options& options = {}
+) {
+    namespace cc = detail::charconv;
+    const char* p = first;
+    bool negative = false;
+    if constexpr (std::is_signed_v<TRep>) {
+        if (p != last && *p == '-') {
+            negative = true;
+            ++p;
+        }
+    }
+
+    std::uint64_t mantissa = 0;
+    int fraction = 0;
+    bool seenDigit = false;
+    bool seenPoint = false;
+    bool overflow = false;
+    for (; p != last; ++p) {
+        if (*p == '.' && !seenPoint) {
+            seenPoint = true;
+            continue;
+        }
+        const auto d = static_cast<unsigned>(*p - '0');
+        if (d > 9) {
+            break;
+        }
+        seenDigit = true;
+        const bool fits = mantissa <= (std::numeric_limits<std::uint64_t>::max() - d) / 10;
+        if (seenPoint) {
+            if (fraction == cc::kMaxDigits || !fits) {
+                // digits past the kept precision are dropped
+                continue;
+            }
+            ++fraction;
+        } else if (!fits) {
+            // keep consuming the number so that `ptr` ends up past it
+            overflow = true;
+            continue;
+        }
+        mantissa = mantissa * 10 + d;
+    }
+    if (!seenDigit) {
+        return { first, std::errc::invalid_argument };
+    }
+
+    const cc::suffix sfx = cc::parse_suffix(p, last, options);
+    const cc::scale scale = cc::kScales<typename TRatio::type>[sfx.binary][sfx.prefix];
+    if (overflow || (scale.den == 0 && mantissa != 0 && !std::is_floating_point_v<TRep>)) {
+        return { sfx.ptr, std::errc::result_out_of_range };
+    }
+
+    if constexpr (std::is_floating_point_v<TRep>) {
+        const TRep magnitude =
+            scale.den != 0
+                ? static_cast<TRep>(mantissa) * static_cast<TRep>(scale.num) /
+                      (static_cast<TRep>(cc::kPow10[fraction]) * static_cast<TRep>(scale.den))
+                : static_cast<TRep>(mantissa) * static_cast<TRep>(cc::kPrefixes[sfx.binary][sfx.prefix]) *
+                      static_cast<TRep>(TRatio::den) /
+                      (static_cast<TRep>(cc::kPow10[fraction]) * static_cast<TRep>(TRatio::num));
+        if (std::isinf(magnitude)) {
+            return { sfx.ptr, std::errc::result_out_of_range };
+        }
+        value = unit<TRep, TRatio>(negative ? -magnitude : magnitude);
+    } else if (mantissa == 0) {
+        value = unit<TRep, TRatio>(0);
+    } else {
+        cc::uint128 quot{};
+        cc::uint128 rem{};
+        cc::divmod(cc::mul(mantissa, scale.num), cc::mul(cc::kPow10[fraction], scale.den), quot, rem);
+        if (!cc::fits64(quot)) {
+            return { sfx.ptr, std::errc::result_out_of_range };
+        }
+        const std::uint64_t magnitude = cc::low64(quot);
+        using TUnsigned = std::make_unsigned_t<TRep>;
+        const auto kMax = static_cast<TUnsigned>(std::numeric_limits<TRep>::max());
+        if (magnitude > kMax + static_cast<TUnsigned>(negative)) {
+            return { sfx.ptr, std::errc::result_out_of_range };
+        }
+        const auto bits = static_cast<TUnsigned>(magnitude);
+        value = unit<TRep, TRatio>(static_cast<TRep>(negative ? static_cast<TUnsigned>(0U - bits) : bits));
+    }
+    return { sfx.ptr, std::errc{} };
+}
+
+/// Result of `from_chars_lines`
+struct from_chars_lines_result {
+    /// Position where parsing stopped: `last`, the start of the offending line, or the first
+    /// unparsed line once the output was full
+    const char* ptr;
+    std::errc ec;
+    /// Number of values written to the output
+    std::size_t count;
+};
+
+namespace detail {
+    namespace charconv {
+        /// Finds line ends 16 bytes at a time and hands them out one by one
+        class line_scanner {
+        public:
+            constexpr line_scanner(const char* first, const char* last)
+                : mBlock(first)
+                , mLast(last) {}
+
+            /// Returns the next '\n' at or after `from`, or `last` if there is none
+            const char* next(const char* from) {
+#if defined(__SSE2__)
+                if (from < mBlock || from >= mBlock + 16) {
+                    mBlock = from;
+                    mMask = 0;
+                    mLoaded = false;
+                }
+                for (;;) {
+                    if (!mLoaded) {
+                        if (mLast - mBlock < 16) {
+                            break;
+                        }
+                        const __m128i chunk = _mm_loadu_si128(static_cast<const __m128i_u*>(
+                            static_cast<const void*>(mBlock)
+                        ));
+                        mMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))));
+                        mLoaded = true;
+                    }
+                    // drop the line ends that were already handed out
+                    const auto consumed = static_cast<unsigned>(from - mBlock);
+                    const unsigned mask = consumed >= 16 ? 0U : mMask & (~0U << consumed);
+                    if (mask != 0) {
+                        return mBlock + __builtin_ctz(mask);
+                    }
+                    mBlock += 16;
+                    from = mBlock;
+                    mLoaded = false;
+                }
+#endif
+                const void* nl = std::memchr(from, '\n', static_cast<std::size_t>(mLast - from));
+                return nl != nullptr ? static_cast<const char*>(nl) : mLast;
+            }
+
+        private:
+            const char* mBlock;
+            const char* mLast;
+            unsigned mMask = 0;
+            bool mLoaded = false;
+        };
+    } // namespace charconv
+} // namespace detail
+
+/// Parses newline-separated sizes from [first, last) into `out`, at most `capacity` of them.
+/// Every line must hold exactly one size (surrounding blanks and a trailing '\r' are allowed);
+/// empty lines are skipped. Stops at the first line that fails to parse.
+template <typename TRep, typename TRatio>
+from_chars_lines_result from_chars_lines(
+    const char* first,
+    const char* last,
+    unit<TRep, TRatio>* out,
+    std::size_t capacity,
+    const parse_options& options = {}
+) {
+    const auto isBlank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    detail::charconv::line_scanner scanner(first, last);
+    std::size_t count = 0;
+    while (first != last) {
+        const char* eol = scanner.next(first);
+        const char* begin = first;
+        const char* end = eol;
+        while (begin != end && isBlank(*begin)) {
+            ++begin;
+        }
+        while (end != begin && isBlank(end[-1])) {
+            --end;
+        }
+        if (begin != end) {
+            if (count == capacity) {
+                return { first, std::errc{}, count };
+            }
+            const auto res = from_chars(begin, end, out[count], options);
+            if (res.ec != std::errc{} || res.ptr != end) {
+                return { first, res.ec != std::errc{} ? res.ec : std::errc::invalid_argument, count };
+            }
+            ++count;
+        }
+        first = eol == last ? last : eol + 1;
+    }
+    return { last, std::errc{}, count };
+}
+
+/// How `to_chars` picks the unit a size is written in
+enum class scaling {
+    /// The unit's own suffix; units without one (e.g. `unit<int, std::ratio<3>>`) are scaled as `iec`
+    none,
+    /// The largest of B, KB, MB, ..., EB not exceeding the size
+    si,
+    /// The largest of B, KiB, MiB, ..., EiB not exceeding the size
+    iec,
+};
+
+/// Options controlling the output of `to_chars`
+struct format_options {
+    scaling scale = scaling::none;
+    /// Digits after the decimal point (at most 64), rounded half away from zero. When negative,
+    /// integral units written in their own suffix are exact and anything else gets at most two
+    /// decimals with trailing zeros removed.
+    int precision = -1;
+    /// Separate the number and the suffix with a space ("1.5 GiB")
+    bool space = true;
+};
+
+namespace detail {
+    namespace charconv {
+        inline constexpr int kMaxPrecision = 64;
+
+        /// Longest text written for a value of `TRep` at up to `kMaxPrecision` decimals: sign, every
+        /// integral digit (of the largest finite value for floating-point reps, of a 128-bit quotient
+        /// for 64-bit reps and a 192-bit one for 128-bit reps), point, decimals, space and suffix
+        template <typename TRep>
+        inline constexpr std::size_t kMaxChars =
+            (std::is_floating_point_v<TRep>
+                 ? static_cast<std::size_t>(std::numeric_limits<TRep>::max_exponent10) + 1
+                 : std::size_t{ sizeof(TRep) > sizeof(std::uint64_t) ? 58U : 39U }) +
+            static_cast<std::size_t>(kMaxPrecision) + 6;
+
+        inline constexpr const char* kSuffixNames[2][7] = {
+            { "B", "KB", "MB", "GB", "TB", "PB", "EB" },
+            { "B", "KiB", "MiB", "GiB", "TiB", "PiB", "EiB" },
+        };
+
+        inline constexpr std::uint64_t kMultipliers[2][7] = {
+            { 1ULL,
+              1000ULL,
+              1000000ULL,
+              1000000000ULL,
+              1000000000000ULL,
+              1000000000000000ULL,
+              1000000000000000000ULL },
+            { 1ULL, 1ULL << 10, 1ULL << 20, 1ULL << 30, 1ULL << 40, 1ULL << 50, 1ULL << 60 },
+        };
+
+        /// Index into `kSuffixNames[binary]` of a ratio, -1 if it has no suffix
+        constexpr int suffix_index(std::intmax_t num, std::intmax_t den, bool binary) {
+            for (int i = 0; i < 7; ++i) {
+                if (den == 1 && static_cast<std::uint64_t>(num) == kMultipliers[binary][i]) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        constexpr int bit_width(std::uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+            return v == 0 ? 0 : 64 - __builtin_clzll(v);
+#else
+            int width = 0;
+            for (int shift = 32; shift > 0; shift /= 2) {
+                if ((v >> shift) != 0) {
+                    v >>= shift;
+                    width += shift;
+                }
+            }
+            return width + static_cast<int>(v);
+#endif
+        }
+
+        /// Largest IEC prefix not exceeding `bytes`, straight from its bit width
+        constexpr int iec_index(std::uint64_t bytes) {
+            const int index = (bit_width(bytes | 1U) - 1) / 10;
+            return index < 6 ? index : 6;
+        }
+
+        /// Largest SI prefix not exceeding `bytes`; the bit width gives floor(log10) up to one
+        constexpr int si_index(std::uint64_t bytes) {
+            const int width = bit_width(bytes);
+            if (width <= 1) {
+                return 0;
+            }
+            // floor((width - 1) * log10(2))
+            const int digits = ((width - 1) * 1233) >> 12;
+            const int index = digits / 3;
+            if (index >= 6) {
+                return 6;
+            }
+            return bytes >= kMultipliers[0][index + 1] ? index + 1 : index;
+        }
+
+        constexpr int scale_index(std::uint64_t bytes, bool binary) {
+            return binary ? iec_index(bytes) : si_index(bytes);
+        }
+
+        struct writer {
+            char* ptr;
+            char* last;
+            bool ok = true;
+
+            void put(char c) {
+                if (ptr == last) {
+                    ok = false;
+                } else {
+                    *ptr++ = c;
+                }
+            }
+
+            void put(const char* s) {
+                for (; *s != '\0'; ++s) {
+                    put(*s);
+                }
+            }
+
+            void put(const char* s, std::size_t n) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    put(s[i]);
+                }
+            }
+
+            void put_uint(uint128 v, int minDigits = 0) {
+                char buf[40];
+                std::size_t n = 0;
+                if (fits64(v) && minDigits == 0) {
+                    n = static_cast<std::size_t>(std::to_chars(buf, buf + sizeof(buf), low64(v)).ptr - buf);
+                    put(buf, n);
+                    return;
+                }
+                uint128 quot{};
+                uint128 rem{};
+                divmod(v, make128(kPow10[kMaxDigits]), quot, rem);
+                if (!is_zero(quot)) {
+                    put_uint(quot);
+                    minDigits = kMaxDigits;
+                }
+                n = static_cast<std::size_t>(std::to_chars(buf, buf + sizeof(buf), low64(rem)).ptr - buf);
+                for (auto pad = static_cast<std::size_t>(minDigits); pad > n; --pad) {
+                    put('0');
+                }
+                put(buf, n);
+            }
+
+#if defined(__SIZEOF_INT128__)
+            void put_uint(wide::uint192 v) {
+                if (v.hi == 0) {
+                    put_uint(v.lo);
+                    return;
+                }
+                const std::uint64_t rem = wide::divmod(v, kPow10[kMaxDigits]);
+                put_uint(v);
+                put_uint(make128(rem), kMaxDigits);
+            }
+#endif
+
+            void put_suffix(const format_options& options, const char* suffix) {
+                if (options.space) {
+                    put(' ');
+                }
+                put(suffix);
+            }
+
+            std::to_chars_result result() const {
+                return { ok ? ptr : last, ok ? std::errc{} : std::errc::value_too_large };
+            }
+        };
+
+        template <typename TRep>
+        std::to_chars_result
+        to_chars_floating(writer out, TRep scaled, const char* suffix, const format_options& options) {
+            const int precision = options.precision < 0 ? 2 : options.precision;
+            char buf[kMaxChars<TRep>];
+            auto res = std::to_chars(buf, buf + sizeof(buf), scaled, std::chars_format::fixed, precision);
+            if (res.ec != std::errc{}) {
+                return { out.last, res.ec };
+            }
+            if (options.precision < 0 && std::memchr(buf, '.', static_cast<std::size_t>(res.ptr - buf)) != nullptr) {
+                while (res.ptr[-1] == '0') {
+                    --res.ptr;
+                }
+                if (res.ptr[-1] == '.') {
+                    --res.ptr;
+                }
+            }
+            out.put(buf, static_cast<std::size_t>(res.ptr - buf));
+            out.put_suffix(options, suffix);
+            return out.result();
+        }
+
+        /// Whether `scaled`, below the next unit, is written as a whole next unit once rounded
+        /// (1023.999 KiB at two decimals)
+        template <typename TRep>
+        bool rounds_to_next(TRep scaled, bool binary, const format_options& options) {
+            const int precision = options.precision < 0 ? 2 : options.precision;
+            char buf[8 + kMaxPrecision];
+            const auto res =
+                std::to_chars(buf, buf + sizeof(buf), scaled, std::chars_format::fixed, precision);
+            std::uint64_t whole = 0;
+            for (const char* p = buf; p != res.ptr && *p != '.'; ++p) {
+                whole = whole * 10 + static_cast<std::uint64_t>(*p - '0');
+            }
+            return res.ec == std::errc{} && whole >= kMultipliers[binary][1];
+        }
+    } // namespace charconv
+} // namespace detail
+
+namespace detail {
+    namespace charconv {
+        /// Suffix to write a value in; a negative index leaves the choice to `format_options::scale`
+        struct target {
+            int index = -1;
+            bool binary = false;
+        };
+
+        /// Writes `quot + rem / denom` units of `index` with the requested decimals, rounding half away
+        /// from zero; `TQuot` is wide enough for the integral part
+        template <typename TQuot>
+        std::to_chars_result write_fixed(
+            writer out,
+            bool negative,
+            TQuot quot,
+            uint128 rem,
+            uint128 denom,
+            int index,
+            bool own,
+            bool automatic,
+            bool binary,
+            const format_options& options
+        ) {
+            const int precision = options.precision < 0               ? (own ? 0 : 2)
+                                  : options.precision < kMaxPrecision ? options.precision
+                                                                      : kMaxPrecision;
+            char digits[kMaxPrecision];
+            for (int i = 0; i < precision; ++i) {
+                uint128 digit{};
+                divmod(mul(rem, 10), denom, digit, rem);
+                digits[i] = static_cast<char>('0' + low64(digit));
+            }
+            // round half away from zero, carrying into the integral part if needed
+            if (!less(mul(rem, 2), denom)) {
+                int i = precision - 1;
+                for (; i >= 0 && digits[i] == '9'; --i) {
+                    digits[i] = '0';
+                }
+                if (i >= 0) {
+                    ++digits[i];
+                } else {
+                    quot = add(quot, 1);
+                    // rounded up to a whole next unit: "1.00 MiB" rather than "1024.00 KiB"
+                    if (automatic && index < 6 && !less(quot, make128(kMultipliers[binary][1]))) {
+                        quot = add(TQuot{}, 1);
+                        ++index;
+                    }
+                }
+            }
+            int length = precision;
+            if (options.precision < 0) {
+                while (length > 0 && digits[length - 1] == '0') {
+                    --length;
+                }
+            }
+
+            if (negative && (!is_zero(quot) || length > 0)) {
+                out.put('-');
+            }
+            out.put_uint(quot);
+            if (length > 0) {
+                out.put('.');
+                out.put(digits, static_cast<std::size_t>(length));
+            }
+            out.put_suffix(options, kSuffixNames[binary][index]);
+            return out.result();
+        }
+
+        template <typename TRep, typename TRatio>
+        std::to_chars_result to_chars(
+            char* first,
+            char* last,
+            const unit<TRep, TRatio>& value,
+            const format_options& options,
+            target fixed
+        ) {
+            using TR = typename TRatio::type;
+            constexpr int kSiIndex = suffix_index(TR::num, TR::den, false);
+            constexpr int kIecIndex = suffix_index(TR::num, TR::den, true);
+            constexpr bool kHasSuffix = kSiIndex >= 0 || kIecIndex >= 0;
+            constexpr bool kOwnBinary = kIecIndex > 0;
+            constexpr int kOwnIndex = kOwnBinary ? kIecIndex : kSiIndex;
+
+            writer out{ first, last };
+            const bool automatic = fixed.index < 0;
+            const bool own = kHasSuffix && (automatic ? options.scale == scaling::none
+                                                      : fixed.index == kOwnIndex && fixed.binary == kOwnBinary);
+            const bool binary = own ? kOwnBinary : automatic ? options.scale != scaling::si : fixed.binary;
+
+            if constexpr (std::is_floating_point_v<TRep>) {
+                if (own) {
+                    return to_chars_floating(out, value.value(), kSuffixNames[binary][kOwnIndex], options);
+                }
+                const TRep total = value.value() * static_cast<TRep>(TR::num) / static_cast<TRep>(TR::den);
+                const TRep magnitude = total < 0 ? -total : total;
+                int index = fixed.index;
+                if (automatic) {
+                    index = 0;
+                    if (magnitude >= 1 &&
+                        magnitude <= static_cast<TRep>(std::numeric_limits<std::uint64_t>::max())) {
+                        index = scale_index(static_cast<std::uint64_t>(magnitude), binary);
+                    } else if (magnitude >= 1) {
+                        index = 6;
+                    }
+                }
+                if (automatic && index < 6) {
+                    const TRep scaled = magnitude / static_cast<TRep>(kMultipliers[binary][index]);
+                    index += rounds_to_next(scaled, binary, options) ? 1 : 0;
+                }
+                return to_chars_floating(
+                    out, total / static_cast<TRep>(kMultipliers[binary][index]), kSuffixNames[binary][index], options
+                );
+            } else {
+                bool negative = false;
+                if constexpr (std::numeric_limits<TRep>::is_signed) {
+                    negative = value.value() < 0;
+                }
+                constexpr auto kNum = static_cast<std::uint64_t>(TR::num);
+                constexpr auto kDen = static_cast<std::uint64_t>(TR::den);
+                int index = own ? kOwnIndex : fixed.index;
+                if constexpr (sizeof(TRep) > sizeof(std::uint64_t)) {
+#if defined(__SIZEOF_INT128__)
+                    // exact size in bytes is magnitude * num / den, divided one 64-bit divisor at a time
+                    const uint128 magnitude = wide::magnitude(value.value(), negative);
+                    wide::uint192 quot{ 0, magnitude };
+                    uint128 rem = 0;
+                    uint128 denom = 1;
+                    if (!own) {
+                        quot = wide::mul(magnitude, kNum);
+                        const std::uint64_t remDen = wide::divmod(quot, kDen);
+                        if (automatic) {
+                            index = quot.hi == 0 && fits64(quot.lo) ? scale_index(low64(quot.lo), binary) : 6;
+                        }
+                        const std::uint64_t remUnit = wide::divmod(quot, kMultipliers[binary][index]);
+                        rem = mul(remUnit, kDen) + remDen;
+                        denom = mul(kDen, kMultipliers[binary][index]);
+                    }
+                    return write_fixed(
+                        out, negative, quot, rem, denom, index, own, automatic, binary, options
+                    );
+#endif
+                } else {
+                    using TUnsigned = std::make_unsigned_t<TRep>;
+                    const auto bits = static_cast<TUnsigned>(value.value());
+                    const auto magnitude =
+                        static_cast<std::uint64_t>(negative ? static_cast<TUnsigned>(0U - bits) : bits);
+
+                    uint128 numer = make128(magnitude);
+                    uint128 denom = make128(1);
+                    if (!own) {
+                        // exact size in bytes is numer / TR::den
+                        numer = mul(magnitude, kNum);
+                        if (automatic) {
+                            uint128 whole{};
+                            uint128 rem{};
+                            divmod(numer, make128(kDen), whole, rem);
+                            index = fits64(whole) ? scale_index(low64(whole), binary) : 6;
+                        }
+                        denom = mul(kDen, kMultipliers[binary][index]);
+                    }
+
+                    uint128 quot{};
+                    uint128 rem{};
+                    divmod(numer, denom, quot, rem);
+                    return write_fixed(
+                        out, negative, quot, rem, denom, index, own, automatic, binary, options
+                    );
+                }
+            }
+        }
+    } // namespace charconv
+} // namespace detail
+
+/// Writes `value` followed by its suffix ("1536 B", "1.5 KiB", "2 GB") into [first, last) without
+/// allocating. With `scaling::si`/`scaling::iec` the largest fitting unit is picked in constant time
+/// from the bit width of the size. Follows `std::to_chars`: on success `ptr` points past the written
+/// characters, otherwise `ec` is `std::errc::value_too_large`.
+template <typename TRep, typename TRatio>
+std::to_chars_result to_chars(
+    char* first,
+    char* last,
+    const unit<TRep, TRatio>& value,
+    const format_options& options = {}
+) {
+    return detail::charconv::to_chars(first, last, value, options, {});
+}
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_CHARCONV_HPP_
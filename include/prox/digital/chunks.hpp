@@ -0,0 +1,314 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_CHUNKS_HPP_
+#define PROX_DIGITAL_CHUNKS_HPP_
+
+#include <prox/digital.hpp>
+#include <prox/digital/align.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// A part of a larger range, e.g. one read of a file split for parallel readers
+template <typename TUnit>
+struct extent {
+    TUnit offset;
+    TUnit length;
+
+    [[nodiscard]] friend constexpr bool operator==(const extent& lhs, const extent& rhs) {
+        return lhs.offset == rhs.offset && lhs.length == rhs.length;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const extent& lhs, const extent& rhs) {
+        return !(lhs == rhs);
+    }
+};
+
+namespace detail {
+    namespace chunks {
+        /// Random-access iterator over a range computing its elements from their index
+        template <typename TRange>
+        class iterator {
+        public:
+            using value_type = typename TRange::value_type;
+            using reference = value_type;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+            using iterator_concept = std::random_access_iterator_tag;
+
+            constexpr iterator() = default;
+
+            constexpr iterator(const TRange* range, std::size_t index)
+                : mRange(range)
+                , mIndex(index) {}
+
+            [[nodiscard]] constexpr reference operator*() const noexcept { return (*mRange)[mIndex]; }
+
+            [[nodiscard]] constexpr reference operator[](difference_type n) const noexcept {
+                return *(*this + n);
+            }
+
+            constexpr iterator& operator++() {
+                ++mIndex;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) {
+                iterator tmp = *this;
+                ++mIndex;
+                return tmp;
+            }
+
+            constexpr iterator& operator--() {
+                --mIndex;
+                return *this;
+            }
+
+            constexpr iterator operator--(int) {
+                iterator tmp = *this;
+                --mIndex;
+                return tmp;
+            }
+
+            constexpr iterator& operator+=(difference_type n) {
+                mIndex = static_cast<std::size_t>(static_cast<difference_type>(mIndex) + n);
+                return *this;
+            }
+
+            constexpr iterator& operator-=(difference_type n) { return *this += -n; }
+
+            [[nodiscard]] friend constexpr iterator operator+(iterator it, difference_type n) {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator+(difference_type n, iterator it) {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator-(iterator it, difference_type n) {
+                return it -= n;
+            }
+
+            [[nodiscard]] friend constexpr difference_type
+            operator-(const iterator& lhs, const iterator& rhs) {
+                return static_cast<difference_type>(lhs.mIndex) - static_cast<difference_type>(rhs.mIndex);
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex == rhs.mIndex;
+            }
+
+            [[nodiscard]] friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex != rhs.mIndex;
+            }
+
+            [[nodiscard]] friend constexpr bool operator<(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex < rhs.mIndex;
+            }
+
+            [[nodiscard]] friend constexpr bool operator<=(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex <= rhs.mIndex;
+            }
+
+            [[nodiscard]] friend constexpr bool operator>(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex > rhs.mIndex;
+            }
+
+            [[nodiscard]] friend constexpr bool operator>=(const iterator& lhs, const iterator& rhs) {
+                return lhs.mIndex >= rhs.mIndex;
+            }
+
+        private:
+            const TRange* mRange = nullptr;
+            std::size_t mIndex = 0;
+        };
+
+        /// CRTP base giving a range with `size()` and `operator[]` its iterators
+        template <typename TRange>
+        class indexed_range {
+        public:
+            using iterator = chunks::iterator<TRange>;
+            using const_iterator = iterator;
+
+            [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(&self(), 0); }
+
+            [[nodiscard]] constexpr iterator end() const noexcept { return iterator(&self(), self().size()); }
+
+            [[nodiscard]] constexpr bool empty() const noexcept { return self().size() == 0; }
+
+        private:
+            constexpr const TRange& self() const noexcept { return static_cast<const TRange&>(*this); }
+        };
+
+        template <typename TRep>
+        inline constexpr bool is_chunkable_v = std::is_integral_v<TRep> && !std::is_same_v<TRep, bool>;
+
+        /// A positive size counted in units of `TRatio`; throws `std::invalid_argument` otherwise
+        template <typename TRatio, typename TRep, typename TRep2, typename TRatio2>
+        constexpr std::make_unsigned_t<TRep> positive(const unit<TRep2, TRatio2>& v, const char* what) {
+            if (v.value() <= 0) {
+                throw std::invalid_argument(what);
+            }
+            return static_cast<std::make_unsigned_t<TRep>>(align::count<TRatio>(v));
+        }
+
+        template <typename TRep>
+        constexpr std::make_unsigned_t<TRep> total(TRep v) {
+            if (v < 0) {
+                throw std::invalid_argument("the total size must not be negative");
+            }
+            return static_cast<std::make_unsigned_t<TRep>>(v);
+        }
+    } // namespace chunks
+} // namespace detail
+
+/// Consecutive chunks of equal size covering [0, total), the last one possibly shorter. See `chunks`.
+template <typename TUnit>
+class chunk_range final : public detail::chunks::indexed_range<chunk_range<TUnit>> {
+    using TRep = typename TUnit::rep;
+    using TUnsigned = std::make_unsigned_t<TRep>;
+
+public:
+    using value_type = extent<TUnit>;
+
+    constexpr chunk_range(TUnsigned total, TUnsigned chunk, TUnsigned alignment)
+        : mTotal(total)
+        , mChunk(chunk % alignment == 0 ? chunk : chunk + (alignment - chunk % alignment))
+        , mCount(static_cast<std::size_t>(mTotal / mChunk + (mTotal % mChunk != 0 ? 1 : 0))) {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return mCount; }
+
+    /// The `i`-th chunk, `i < size()`
+    [[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept {
+        const auto offset = static_cast<TUnsigned>(static_cast<TUnsigned>(i) * mChunk);
+        const TUnsigned length = std::min<TUnsigned>(mChunk, static_cast<TUnsigned>(mTotal - offset));
+        return { TUnit(static_cast<TRep>(offset)), TUnit(static_cast<TRep>(length)) };
+    }
+
+    /// The chunk size after rounding up to the alignment
+    [[nodiscard]] constexpr TUnit chunk_size() const noexcept { return TUnit(static_cast<TRep>(mChunk)); }
+
+private:
+    TUnsigned mTotal;
+    TUnsigned mChunk;
+    std::size_t mCount;
+};
+
+/// [0, total) split into one extent per worker. Lengths differ by at most one alignment unit: the
+/// workers with an extra unit come last, along with the partial unit at the end. See `partition`.
+template <typename TUnit>
+class partition_range final : public detail::chunks::indexed_range<partition_range<TUnit>> {
+    using TRep = typename TUnit::rep;
+    using TUnsigned = std::make_unsigned_t<TRep>;
+
+public:
+    using value_type = extent<TUnit>;
+
+    constexpr partition_range(TUnsigned total, std::size_t workers, TUnsigned alignment)
+        : mTotal(total)
+        , mAlignment(alignment)
+        , mWorkers(workers)
+        , mBase(granules() / static_cast<TUnsigned>(workers))
+        , mExtra(static_cast<std::size_t>(granules() % static_cast<TUnsigned>(workers))) {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return mWorkers; }
+
+    /// The extent of worker `i`, `i < size()`. The first workers get empty extents when there are more
+    /// workers than alignment units in the total.
+    [[nodiscard]] constexpr value_type operator[](std::size_t i) const noexcept {
+        const std::size_t shorter = mWorkers - mExtra;
+        const TUnsigned longer = i > shorter ? static_cast<TUnsigned>(i - shorter) : 0;
+        const TUnsigned first = static_cast<TUnsigned>(i) * mBase + longer;
+        const TUnsigned count = mBase + (i >= shorter ? 1 : 0);
+        const TUnsigned offset = std::min<TUnsigned>(first * mAlignment, mTotal);
+        const TUnsigned end = std::min<TUnsigned>((first + count) * mAlignment, mTotal);
+        return { TUnit(static_cast<TRep>(offset)), TUnit(static_cast<TRep>(end - offset)) };
+    }
+
+private:
+    /// Alignment units in the total, counting a partial last one
+    constexpr TUnsigned granules() const noexcept {
+        return mTotal / mAlignment + (mTotal % mAlignment != 0 ? 1 : 0);
+    }
+
+    TUnsigned mTotal;
+    TUnsigned mAlignment;
+    std::size_t mWorkers;
+    TUnsigned mBase;
+    std::size_t mExtra;
+};
+
+/// Splits [0, total) into chunks of `chunk_size` rounded up to a multiple of `alignment`, e.g.
+/// `chunks(file_size, 64_MiB, 4_KiB)`. The result is a random-access range of `extent`s computed on
+/// access, so a thread pool can index it directly. Offsets are multiples of the alignment, which
+/// need not be a power of two. Throws `std::invalid_argument` for a negative total or a chunk size or
+/// alignment that isn't positive.
+template <typename TRep,
+          typename TRatio,
+          typename TRep2,
+          typename TRatio2,
+          typename TRep3 = TRep,
+          typename TRatio3 = TRatio>
+[[nodiscard]] constexpr auto chunks(
+    const unit<TRep, TRatio>& total,
+    const unit<TRep2, TRatio2>& chunk_size,
+    const unit<TRep3, TRatio3>& alignment = unit<TRep3, TRatio3>(1)
+) -> std::enable_if_t<detail::chunks::is_chunkable_v<TRep>, chunk_range<unit<TRep, TRatio>>> {
+    return chunk_range<unit<TRep, TRatio>>(
+        detail::chunks::total(total.value()),
+        detail::chunks::positive<TRatio, TRep>(chunk_size, "the chunk size must be positive"),
+        detail::chunks::positive<TRatio, TRep>(alignment, "the alignment must be positive")
+    );
+}
+
+/// Splits [0, total) into `workers` extents whose offsets are multiples of `alignment`, balancing the
+/// remainder across the last workers, e.g. `partition(file_size, threads, 4_KiB)`. Like `chunks`, the
+/// result is a random-access range computed on access. Throws `std::invalid_argument` for a negative
+/// total, no workers or an alignment that isn't positive.
+template <typename TRep, typename TRatio, typename TRep2 = TRep, typename TRatio2 = TRatio>
+[[nodiscard]] constexpr auto partition(
+    const unit<TRep, TRatio>& total,
+    std::size_t workers,
+    const unit<TRep2, TRatio2>& alignment = unit<TRep2, TRatio2>(1)
+) -> std::enable_if_t<detail::chunks::is_chunkable_v<TRep>, partition_range<unit<TRep, TRatio>>> {
+    if (workers == 0) {
+        throw std::invalid_argument("there must be at least one worker");
+    }
+    return partition_range<unit<TRep, TRatio>>(
+        detail::chunks::total(total.value()),
+        workers,
+        detail::chunks::positive<TRatio, TRep>(alignment, "the alignment must be positive")
+    );
+}
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_CHUNKS_HPP_
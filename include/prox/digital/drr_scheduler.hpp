@@ -0,0 +1,254 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_DRR_SCHEDULER_HPP_
+#define PROX_DIGITAL_DRR_SCHEDULER_HPP_
+
+#include <prox/digital.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+namespace detail {
+    namespace scheduling {
+        /// A bounded single-producer single-consumer ring
+        template <typename T>
+        class spsc_ring {
+        public:
+            explicit spsc_ring(std::size_t capacity)
+                : mSlots(round_up(capacity))
+                , mMask(mSlots.size() - 1) {}
+
+            [[nodiscard]] std::size_t capacity() const { return mSlots.size(); }
+
+            bool push(T&& value) {
+                const std::size_t tail = mTail.load(std::memory_order_relaxed);
+                if (tail - mHeadCache == mSlots.size()) {
+                    mHeadCache = mHead.load(std::memory_order_acquire);
+                    if (tail - mHeadCache == mSlots.size()) {
+                        return false;
+                    }
+                }
+                mSlots[tail & mMask].emplace(std::move(value));
+                mTail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            template <typename TSink>
+            void drain(TSink&& sink) {
+                const std::size_t head = mHead.load(std::memory_order_relaxed);
+                const std::size_t tail = mTail.load(std::memory_order_acquire);
+                for (std::size_t i = head; i != tail; ++i) {
+                    auto& slot = mSlots[i & mMask];
+                    sink(std::move(*slot));
+                    slot.reset();
+                }
+                mHead.store(tail, std::memory_order_release);
+            }
+
+        private:
+            static std::size_t round_up(std::size_t n) {
+                std::size_t pow2 = 1;
+                while (pow2 < n) {
+                    pow2 <<= 1;
+                }
+                return pow2;
+            }
+
+            std::vector<std::optional<T>> mSlots;
+            std::size_t mMask;
+            alignas(64) std::atomic<std::size_t> mHead{ 0 };
+            alignas(64) std::atomic<std::size_t> mTail{ 0 };
+            std::size_t mHeadCache = 0;
+        };
+    } // namespace scheduling
+} // namespace detail
+
+/// Weighted fair queuing by size: deficit round robin over flows of `T` items
+///
+/// Each turn a flow earns `quantum * weight` and sends items while its deficit covers their size,
+/// so over time flows get bandwidth in proportion to their weights regardless of item sizes.
+/// Dequeuing is O(1) per item as long as the quantum is at least the largest item size.
+///
+/// The scheduler is not thread-safe, with one exception: when created with a submit capacity, a
+/// single producer thread may `submit()` items without locking while another thread dequeues.
+template <typename T, typename TUnit = bytes>
+class drr_scheduler final {
+public:
+    using flow_id = std::size_t;
+    using unit_type = TUnit;
+
+    struct item {
+        flow_id flow;
+        T value;
+        TUnit size;
+    };
+
+    /// Throws `std::invalid_argument` unless `quantum` is positive
+    explicit drr_scheduler(TUnit quantum, std::size_t submitCapacity = 0)
+        : mQuantum(quantum) {
+        if (quantum <= TUnit::zero()) {
+            throw std::invalid_argument("the quantum must be positive");
+        }
+        if (submitCapacity != 0) {
+            mSubmitted.emplace(submitCapacity);
+        }
+    }
+
+    /// Adds a flow; flows are numbered from zero in the order they're added. Throws
+    /// `std::invalid_argument` for a zero weight, which would never earn credit, and for a weight
+    /// whose `quantum * weight` doesn't fit the rep.
+    flow_id add_flow(unsigned weight = 1) {
+        using TRep = typename TUnit::rep;
+        if (weight == 0) {
+            throw std::invalid_argument("the flow weight must be positive");
+        }
+        const TRep limit = TUnit::max().value() / mQuantum.value();
+        bool fits = false;
+        if constexpr (detail::is_integral_rep_v<TRep>) {
+            fits = weight <= static_cast<detail::widest_unsigned>(limit);
+        } else {
+            fits = static_cast<TRep>(weight) <= limit;
+        }
+        if (!fits) {
+            throw std::invalid_argument("the flow weight overflows the quantum");
+        }
+        mFlows.push_back(flow{ {}, TUnit::zero(), mQuantum * static_cast<TRep>(weight), false });
+        // unwrap the ring of active flows into the larger one
+        std::vector<flow_id> active(mFlows.size());
+        for (std::size_t i = 0; i < mActiveCount; ++i) {
+            active[i] = mActive[(mActiveHead + i) % mActive.size()];
+        }
+        mActive = std::move(active);
+        mActiveHead = 0;
+        mFlowCount.store(mFlows.size(), std::memory_order_release);
+        return mFlows.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t flows() const { return mFlows.size(); }
+
+    /// Items waiting, not counting submitted ones not yet picked up by `dequeue()`
+    [[nodiscard]] std::size_t size() const { return mSize; }
+
+    [[nodiscard]] bool empty() const { return mSize == 0; }
+
+    /// Throws `std::out_of_range` unless `id` came from `add_flow()`
+    void enqueue(flow_id id, T value, TUnit size) {
+        check_flow(id);
+        flow& f = mFlows[id];
+        f.queue.push_back({ id, std::move(value), size });
+        if (f.queue.size() == 1) {
+            // the flow becomes active at the end of the round
+            mActive[(mActiveHead + mActiveCount) % mActive.size()] = id;
+            ++mActiveCount;
+        }
+        ++mSize;
+    }
+
+    /// Hands an item to the scheduler from the single producer thread; false if the submit ring is full.
+    /// Throws `std::logic_error` if the scheduler was created without a submit capacity and
+    /// `std::out_of_range` unless `id` came from an `add_flow()` that happened before the call.
+    bool submit(flow_id id, T value, TUnit size) {
+        if (!mSubmitted) {
+            throw std::logic_error("the scheduler has no submit ring");
+        }
+        check_flow(id);
+        return mSubmitted->push(item{ id, std::move(value), size });
+    }
+
+    /// The next item in deficit round robin order
+    std::optional<item> dequeue() {
+        if (mSubmitted) {
+            mSubmitted->drain([this](item&& i) { enqueue(i.flow, std::move(i.value), i.size); });
+        }
+        while (mActiveCount != 0) {
+            const flow_id id = mActive[mActiveHead];
+            flow& f = mFlows[id];
+            if (!f.served) {
+                f.deficit += f.quantum;
+                f.served = true;
+            }
+            if (f.queue.front().size <= f.deficit) {
+                item next = std::move(f.queue.front());
+                f.queue.pop_front();
+                f.deficit -= next.size;
+                --mSize;
+                if (f.queue.empty()) {
+                    // an idle flow doesn't bank credit
+                    f.deficit = TUnit::zero();
+                    f.served = false;
+                    pop_active();
+                }
+                return next;
+            }
+            // the turn is over, move to the back of the round
+            f.served = false;
+            pop_active();
+            mActive[(mActiveHead + mActiveCount) % mActive.size()] = id;
+            ++mActiveCount;
+        }
+        return std::nullopt;
+    }
+
+private:
+    struct flow {
+        std::deque<item> queue;
+        TUnit deficit;
+        TUnit quantum;
+        bool served;
+    };
+
+    void check_flow(flow_id id) const {
+        // flows are never removed, so an id below the published count stays valid
+        if (id >= mFlowCount.load(std::memory_order_acquire)) {
+            throw std::out_of_range("unknown flow id");
+        }
+    }
+
+    void pop_active() {
+        mActiveHead = (mActiveHead + 1) % mActive.size();
+        --mActiveCount;
+    }
+
+    TUnit mQuantum;
+    std::vector<flow> mFlows;
+    /// `mFlows.size()`, readable from the producer thread
+    std::atomic<std::size_t> mFlowCount{ 0 };
+    /// Ring of active flows; a flow is in it at most once, so it never holds more than all flows
+    std::vector<flow_id> mActive;
+    std::size_t mActiveHead = 0;
+    std::size_t mActiveCount = 0;
+    std::size_t mSize = 0;
+    std::optional<detail::scheduling::spsc_ring<item>> mSubmitted;
+};
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_DRR_SCHEDULER_HPP_
@@ -0,0 +1,216 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_DYNAMIC_HPP_
+#define PROX_DIGITAL_DYNAMIC_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Scale of a `dynamic_unit`, named after the literal suffixes: bytes or one of the predefined decimal
+/// and binary multiples
+enum class dynamic_scale : std::uint8_t { B, KB, MB, GB, TB, PB, EB, KiB, MiB, GiB, TiB, PiB, EiB };
+
+namespace detail {
+    namespace dynamic {
+        inline constexpr std::size_t kScales = 13;
+
+        inline constexpr std::uint64_t kMultipliers[kScales] = { 1ULL,
+                                                                 1000ULL,
+                                                                 1000000ULL,
+                                                                 1000000000ULL,
+                                                                 1000000000000ULL,
+                                                                 1000000000000000ULL,
+                                                                 1000000000000000000ULL,
+                                                                 1ULL << 10,
+                                                                 1ULL << 20,
+                                                                 1ULL << 30,
+                                                                 1ULL << 40,
+                                                                 1ULL << 50,
+                                                                 1ULL << 60 };
+
+        /// The `dynamic_scale` of a ratio, -1 if it is not one of them
+        template <typename TRatio>
+        constexpr int scale_index() {
+            using TR = typename TRatio::type;
+            for (std::size_t i = 0; i < kScales; ++i) {
+                if (TR::den == 1 && static_cast<std::uint64_t>(TR::num) == kMultipliers[i]) {
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        /// Factor from a scale to a static ratio, `num / den` in lowest terms
+        struct conversion {
+            std::uint64_t num;
+            std::uint64_t den;
+            wide::divider div;
+        };
+
+        template <typename TFrom, typename TTo>
+        constexpr conversion make_conversion() {
+            using TDivide = std::ratio_divide<TFrom, TTo>;
+            return { static_cast<std::uint64_t>(TDivide::num),
+                     static_cast<std::uint64_t>(TDivide::den),
+                     wide::make_divider(static_cast<std::uint64_t>(TDivide::den)) };
+        }
+
+        /// Conversions from every `dynamic_scale` into `TRatio`, indexed by the scale
+        template <typename TRatio>
+        inline constexpr conversion kConversions[kScales] = {
+            make_conversion<identity, TRatio>(),
+            make_conversion<kilo, TRatio>(),
+            make_conversion<mega, TRatio>(),
+            make_conversion<giga, TRatio>(),
+            make_conversion<tera, TRatio>(),
+            make_conversion<peta, TRatio>(),
+            make_conversion<exa, TRatio>(),
+            make_conversion<kibi, TRatio>(),
+            make_conversion<mebi, TRatio>(),
+            make_conversion<gibi, TRatio>(),
+            make_conversion<tebi, TRatio>(),
+            make_conversion<pebi, TRatio>(),
+            make_conversion<exbi, TRatio>(),
+        };
+
+        /// `v * c.num / c.den` truncated, valid when the quotient fits in 64 bits
+        constexpr std::uint64_t convert(std::uint64_t v, const conversion& c) {
+            return wide::divide(wide::mul(v, c.num), c.div);
+        }
+
+        constexpr std::uint64_t magnitude(std::int64_t v) {
+            const auto bits = static_cast<std::uint64_t>(v);
+            return v < 0 ? 0U - bits : bits;
+        }
+    } // namespace dynamic
+} // namespace detail
+
+/// A size whose scale is only known at runtime, e.g. read from a configuration file or a message:
+/// an `std::int64_t` count and a one-byte `dynamic_scale`. Converts implicitly from the static units
+/// with a matching ratio and into any static unit, truncating toward zero like `unit_cast`; the
+/// conversion is a lookup into a table built for the target ratio, without branching on the scale.
+class dynamic_unit final {
+public:
+    using rep = std::int64_t;
+
+    constexpr dynamic_unit() = default;
+
+    constexpr dynamic_unit(rep value, dynamic_scale scale)
+        : mValue(value)
+        , mScale(scale) {}
+
+    template <
+        typename TRep,
+        typename TRatio,
+        std::enable_if_t<std::is_integral_v<TRep> && (detail::dynamic::scale_index<TRatio>() >= 0), bool> =
+            true>
+    constexpr dynamic_unit(const unit<TRep, TRatio>& value) // NOLINT: same size, different bookkeeping
+        : mValue(static_cast<rep>(value.value()))
+        , mScale(static_cast<dynamic_scale>(detail::dynamic::scale_index<TRatio>())) {}
+
+    [[nodiscard]] constexpr rep value() const { return mValue; }
+
+    [[nodiscard]] constexpr dynamic_scale scale() const { return mScale; }
+
+    template <typename TRep, typename TRatio>
+    constexpr operator unit<TRep, TRatio>() const { // NOLINT: the point of the type
+        const detail::dynamic::conversion& c =
+            detail::dynamic::kConversions<typename TRatio::type>[static_cast<std::size_t>(mScale)];
+        if constexpr (std::is_floating_point_v<TRep>) {
+            return unit<TRep, TRatio>(static_cast<TRep>(mValue) * static_cast<TRep>(c.num) /
+                                      static_cast<TRep>(c.den));
+        } else {
+            const std::uint64_t q = detail::dynamic::convert(detail::dynamic::magnitude(mValue), c);
+            return unit<TRep, TRatio>(static_cast<TRep>(mValue < 0 ? 0U - q : q));
+        }
+    }
+
+    [[nodiscard]] constexpr dynamic_unit operator-() const {
+        return { static_cast<rep>(0U - static_cast<std::uint64_t>(mValue)), mScale };
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) == 0;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) != 0;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) < 0;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) <= 0;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) > 0;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        return compare(lhs, rhs) >= 0;
+    }
+
+private:
+    /// Compares the values directly when the scales match and the exact sizes in bytes otherwise
+    static constexpr int compare(const dynamic_unit& lhs, const dynamic_unit& rhs) {
+        if (lhs.mScale == rhs.mScale) {
+            return (lhs.mValue > rhs.mValue) - (lhs.mValue < rhs.mValue);
+        }
+        const bool negL = lhs.mValue < 0;
+        const bool negR = rhs.mValue < 0;
+        if (negL != negR) {
+            return negL ? -1 : 1;
+        }
+        using detail::dynamic::kMultipliers;
+        const detail::wide::uint128 l = detail::wide::mul(
+            detail::dynamic::magnitude(lhs.mValue), kMultipliers[static_cast<std::size_t>(lhs.mScale)]
+        );
+        const detail::wide::uint128 r = detail::wide::mul(
+            detail::dynamic::magnitude(rhs.mValue), kMultipliers[static_cast<std::size_t>(rhs.mScale)]
+        );
+        int res = 0;
+        if (l.hi != r.hi) {
+            res = l.hi < r.hi ? -1 : 1;
+        } else if (l.lo != r.lo) {
+            res = l.lo < r.lo ? -1 : 1;
+        }
+        return negL ? -res : res;
+    }
+
+    rep mValue = 0;
+    dynamic_scale mScale = dynamic_scale::B;
+};
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_DYNAMIC_HPP_
@@ -0,0 +1,333 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_FIXED_HPP_
+#define PROX_DIGITAL_FIXED_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+template <typename TInt, unsigned TFracBits>
+class fixed;
+
+namespace detail {
+    namespace fixed_point {
+        template <typename T>
+        inline constexpr bool is_fixed_v = false;
+
+        template <typename TInt, unsigned TFracBits>
+        inline constexpr bool is_fixed_v<fixed<TInt, TFracBits>> = true;
+
+        /// Integer type holding the product of two `TInt`s, `void` if there is none
+        template <typename TInt>
+        struct wide {
+#if defined(__SIZEOF_INT128__)
+            using type = std::conditional_t<
+                sizeof(TInt) <= sizeof(std::int32_t),
+                std::conditional_t<std::numeric_limits<TInt>::is_signed, std::int64_t, std::uint64_t>,
+                typename detail::wide::int128<TInt>::type>;
+#else
+            using type = std::conditional_t<
+                sizeof(TInt) <= sizeof(std::int32_t),
+                std::conditional_t<std::numeric_limits<TInt>::is_signed, std::int64_t, std::uint64_t>,
+                void>;
+#endif
+        };
+
+        template <typename TInt>
+        using wide_t = typename wide<TInt>::type;
+
+        /// Common type of a fixed-point type and `T`: the fixed-point type for integers, `T` for floating
+        /// point, none otherwise
+        template <
+            typename TFixed,
+            typename T,
+            bool TInteger = std::numeric_limits<T>::is_integer,
+            bool TFloating = std::is_floating_point_v<T>>
+        struct common_with {};
+
+        template <typename TFixed, typename T>
+        struct common_with<TFixed, T, true, false> {
+            using type = TFixed;
+        };
+
+        template <typename TFixed, typename T>
+        struct common_with<TFixed, T, false, true> {
+            using type = T;
+        };
+
+        /// `value * TNum / TDen` truncated toward zero. Narrow integers are scaled in 64 bits, where the
+        /// factors and the remainder product `value % TDen * TNum` fit; only the result is narrowed.
+        template <std::intmax_t TNum, std::intmax_t TDen, typename TInt>
+        constexpr TInt scale(TInt value) {
+            using TCalc = std::conditional_t<
+                (sizeof(TInt) < sizeof(std::int64_t)),
+                std::conditional_t<std::numeric_limits<TInt>::is_signed, std::int64_t, std::uint64_t>,
+                TInt>;
+            constexpr auto kNum = static_cast<TCalc>(TNum);
+            constexpr auto kDen = static_cast<TCalc>(TDen);
+            const auto v = static_cast<TCalc>(value);
+            if constexpr (TNum == 1 && TDen == 1) {
+                return value;
+            } else if constexpr (TDen == 1) {
+                return static_cast<TInt>(v * kNum);
+            } else if constexpr (TNum == 1) {
+                return static_cast<TInt>(v / kDen);
+            } else if constexpr (TNum <= std::numeric_limits<std::int64_t>::max() / TDen) {
+                return static_cast<TInt>(v / kDen * kNum + v % kDen * kNum / kDen);
+            } else {
+                static_assert(!std::is_void_v<wide_t<TInt>>, "scaling needs a 128-bit integer type");
+                using TWide = wide_t<TInt>;
+                return static_cast<TInt>(static_cast<TWide>(value) * TNum / TDen);
+            }
+        }
+    } // namespace fixed_point
+} // namespace detail
+
+/// Binary fixed-point number with `TFracBits` fractional bits stored in `TInt`, for fractional sizes
+/// computed on integer ALUs, e.g. `unit<fixed<std::int64_t, 16>, gibi>`. Addition and subtraction are
+/// exact; multiplication, division and conversions truncate toward zero to the nearest 2^-TFracBits.
+template <typename TInt, unsigned TFracBits>
+class fixed final {
+    static_assert(std::numeric_limits<TInt>::is_integer, "fixed requires an integral representation");
+    static_assert(TFracBits < static_cast<unsigned>(std::numeric_limits<TInt>::digits),
+                  "fixed requires at least one integral bit");
+
+    using TWide = detail::fixed_point::wide_t<TInt>;
+
+public:
+    using rep = TInt;
+    static constexpr unsigned frac_bits = TFracBits;
+    static constexpr TInt one = TInt{ 1 } << TFracBits;
+
+    constexpr fixed() = default;
+
+    template <typename TInt2, std::enable_if_t<std::numeric_limits<TInt2>::is_integer, bool> = true>
+    constexpr fixed(TInt2 value) // NOLINT: integers convert implicitly and exactly
+        : mRaw(static_cast<TInt>(static_cast<TInt>(value) * one)) {}
+
+    /// Rounds to the nearest representable value
+    template <typename TFloat, std::enable_if_t<std::is_floating_point_v<TFloat>, bool> = true>
+    constexpr explicit fixed(TFloat value)
+        : mRaw(round(value * static_cast<TFloat>(one))) {}
+
+    /// Converts between fixed-point types, truncating dropped fractional bits toward zero
+    template <typename TInt2, unsigned TFracBits2>
+    constexpr explicit fixed(const fixed<TInt2, TFracBits2>& other)
+        : mRaw(convert(other)) {}
+
+    [[nodiscard]] static constexpr fixed from_raw(TInt raw) {
+        fixed res;
+        res.mRaw = raw;
+        return res;
+    }
+
+    [[nodiscard]] constexpr TInt raw() const { return mRaw; }
+
+    /// Truncates toward zero
+    template <typename TInt2, std::enable_if_t<std::numeric_limits<TInt2>::is_integer, bool> = true>
+    constexpr explicit operator TInt2() const {
+        return static_cast<TInt2>(mRaw / one);
+    }
+
+    template <typename TFloat, std::enable_if_t<std::is_floating_point_v<TFloat>, bool> = true>
+    constexpr explicit operator TFloat() const {
+        return static_cast<TFloat>(mRaw) / static_cast<TFloat>(one);
+    }
+
+    [[nodiscard]] constexpr fixed operator+() const { return *this; }
+
+    [[nodiscard]] constexpr fixed operator-() const { return from_raw(static_cast<TInt>(-mRaw)); }
+
+    constexpr fixed& operator++() { return *this += fixed(1); }
+
+    constexpr fixed operator++(int) {
+        const fixed res = *this;
+        ++*this;
+        return res;
+    }
+
+    constexpr fixed& operator--() { return *this -= fixed(1); }
+
+    constexpr fixed operator--(int) {
+        const fixed res = *this;
+        --*this;
+        return res;
+    }
+
+    constexpr fixed& operator+=(const fixed& rhs) {
+        mRaw = static_cast<TInt>(mRaw + rhs.mRaw);
+        return *this;
+    }
+
+    constexpr fixed& operator-=(const fixed& rhs) {
+        mRaw = static_cast<TInt>(mRaw - rhs.mRaw);
+        return *this;
+    }
+
+    constexpr fixed& operator*=(const fixed& rhs) {
+        static_assert(!std::is_void_v<TWide>, "multiplying 64-bit fixed-point values needs __int128");
+        mRaw = static_cast<TInt>(static_cast<TWide>(mRaw) * rhs.mRaw / one);
+        return *this;
+    }
+
+    constexpr fixed& operator/=(const fixed& rhs) {
+        static_assert(!std::is_void_v<TWide>, "dividing 64-bit fixed-point values needs __int128");
+        mRaw = static_cast<TInt>(static_cast<TWide>(mRaw) * one / rhs.mRaw);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr fixed operator+(fixed lhs, const fixed& rhs) { return lhs += rhs; }
+
+    [[nodiscard]] friend constexpr fixed operator-(fixed lhs, const fixed& rhs) { return lhs -= rhs; }
+
+    [[nodiscard]] friend constexpr fixed operator*(fixed lhs, const fixed& rhs) { return lhs *= rhs; }
+
+    [[nodiscard]] friend constexpr fixed operator/(fixed lhs, const fixed& rhs) { return lhs /= rhs; }
+
+    [[nodiscard]] friend constexpr bool operator==(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw == rhs.mRaw;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw != rhs.mRaw;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw < rhs.mRaw;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw <= rhs.mRaw;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw > rhs.mRaw;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const fixed& lhs, const fixed& rhs) {
+        return lhs.mRaw >= rhs.mRaw;
+    }
+
+private:
+    template <typename TFloat>
+    static constexpr TInt round(TFloat scaled) {
+        return static_cast<TInt>(scaled < 0 ? scaled - TFloat(0.5) : scaled + TFloat(0.5));
+    }
+
+    template <typename TInt2, unsigned TFracBits2>
+    static constexpr TInt convert(const fixed<TInt2, TFracBits2>& other) {
+        if constexpr (TFracBits2 > TFracBits) {
+            return static_cast<TInt>(other.raw() / (TInt2{ 1 } << (TFracBits2 - TFracBits)));
+        } else {
+            return static_cast<TInt>(
+                static_cast<TInt>(other.raw()) * (TInt{ 1 } << (TFracBits - TFracBits2))
+            );
+        }
+    }
+
+    TInt mRaw = 0;
+};
+
+namespace detail {
+    // unit_cast of fixed-point reps scales the raw value directly, which is exact where the ratio is and
+    // never needs the wide multiply and division of `fixed`'s own operators
+    template <typename TTo, typename TDivide, typename TFixed>
+    struct fixed_unit_cast {
+        template <typename TRep, typename TRatio>
+        constexpr TTo operator()(const unit<TRep, TRatio>& from) const {
+            const TFixed value = static_cast<TFixed>(from.value());
+            return TTo(static_cast<typename TTo::rep>(TFixed::from_raw(
+                fixed_point::scale<TDivide::num, TDivide::den>(value.raw())
+            )));
+        }
+    };
+
+    template <typename TTo, typename TDivide, typename TInt, unsigned TFracBits>
+    struct unit_cast<TTo, TDivide, fixed<TInt, TFracBits>, false, false, false, false>
+        : fixed_unit_cast<TTo, TDivide, fixed<TInt, TFracBits>> {};
+
+    template <typename TTo, typename TDivide, typename TInt, unsigned TFracBits>
+    struct unit_cast<TTo, TDivide, fixed<TInt, TFracBits>, true, false, false, false>
+        : fixed_unit_cast<TTo, TDivide, fixed<TInt, TFracBits>> {};
+
+    template <typename TTo, typename TDivide, typename TInt, unsigned TFracBits>
+    struct unit_cast<TTo, TDivide, fixed<TInt, TFracBits>, false, true, false, false>
+        : fixed_unit_cast<TTo, TDivide, fixed<TInt, TFracBits>> {};
+} // namespace detail
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+namespace std {
+template <typename TInt, unsigned TFracBits>
+struct numeric_limits<PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>> {
+    using TFixed = PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = numeric_limits<TInt>::is_signed;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool is_bounded = true;
+    static constexpr int radix = 2;
+    static constexpr int digits = numeric_limits<TInt>::digits;
+
+    static constexpr TFixed min() { return TFixed::from_raw(numeric_limits<TInt>::lowest()); }
+    static constexpr TFixed lowest() { return TFixed::from_raw(numeric_limits<TInt>::lowest()); }
+    static constexpr TFixed max() { return TFixed::from_raw(numeric_limits<TInt>::max()); }
+    static constexpr TFixed epsilon() { return TFixed::from_raw(1); }
+};
+
+template <typename TInt, unsigned TFracBits, typename T>
+struct common_type<PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>, T>
+    : PROX_DIGITAL_NAMESPACE_NAME::detail::fixed_point::common_with<
+          PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>,
+          T> {};
+
+template <typename T, typename TInt, unsigned TFracBits>
+struct common_type<T, PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>>
+    : PROX_DIGITAL_NAMESPACE_NAME::detail::fixed_point::common_with<
+          PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>,
+          T> {};
+
+template <typename TInt1, unsigned TFracBits1, typename TInt2, unsigned TFracBits2>
+struct common_type<
+    PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt1, TFracBits1>,
+    PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt2, TFracBits2>> {
+    using type = PROX_DIGITAL_NAMESPACE_NAME::
+        fixed<common_type_t<TInt1, TInt2>, (TFracBits1 > TFracBits2 ? TFracBits1 : TFracBits2)>;
+};
+
+template <typename TInt, unsigned TFracBits>
+struct hash<PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>> {
+    std::size_t operator()(const PROX_DIGITAL_NAMESPACE_NAME::fixed<TInt, TFracBits>& value) const {
+        return hash<TInt>{}(value.raw());
+    }
+};
+} // namespace std
+
+#endif // PROX_DIGITAL_FIXED_HPP_
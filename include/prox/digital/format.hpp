@@ -0,0 +1,255 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_FORMAT_HPP_
+#define PROX_DIGITAL_FORMAT_HPP_
+
+#include <prox/digital/charconv.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_format)
+#include <format>
+#define PROX_DIGITAL_HAS_STD_FORMAT
+#endif
+
+// fmt support is enabled when fmt is included first or PROX_DIGITAL_USE_FMT is defined
+#if defined(FMT_VERSION) || defined(PROX_DIGITAL_USE_FMT)
+#include <fmt/format.h>
+#define PROX_DIGITAL_HAS_FMT
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+namespace detail {
+    namespace formatting {
+        /// Parsed format spec:
+        /// `[[fill]align][#][width][.precision][raw | iB | sB | B | KB ... EB | KiB ... EiB]`
+        ///
+        /// Fill, align (`<`, `>`, `^`) and width are the standard ones, left-aligned by default like
+        /// strings and chrono durations. `#` drops the space before the suffix, `raw` writes only the
+        /// rep, `iB`/`sB` pick the largest IEC/SI unit and an explicit suffix converts to that unit.
+        /// An empty spec is `to_chars`.
+        struct spec {
+            bool raw = false;
+            format_options options;
+            charconv::target target;
+            char fill = ' ';
+            char align = '<';
+            std::size_t width = 0;
+        };
+
+        constexpr bool is_align(char c) {
+            return c == '<' || c == '>' || c == '^';
+        }
+
+        constexpr bool equals(const char* lhs, const char* first, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (lhs[i] == '\0' || lhs[i] != first[i]) {
+                    return false;
+                }
+            }
+            return lhs[size] == '\0';
+        }
+
+        /// Widths past this are rejected rather than risk overflowing the arithmetic
+        inline constexpr std::size_t kMaxWidth = 1U << 20;
+
+        /// Parses the spec up to the closing '}', advancing `it` to it; false if the spec is invalid
+        template <bool TFloating, typename TIt>
+        constexpr bool parse(TIt& it, TIt last, spec& out) {
+            // an empty spec ends at once; the text after its '}' is not an align char
+            if (it != last && *it != '}' && it + 1 != last && is_align(it[1])) {
+                if (*it == '{') {
+                    return false;
+                }
+                out.fill = *it;
+                out.align = it[1];
+                it += 2;
+            } else if (it != last && is_align(*it)) {
+                out.align = *it;
+                ++it;
+            }
+            if (it != last && *it == '#') {
+                out.options.space = false;
+                ++it;
+            }
+            if (it != last && *it >= '1' && *it <= '9') {
+                for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+                    if (out.width > kMaxWidth / 10) {
+                        return false;
+                    }
+                    out.width = out.width * 10 + static_cast<std::size_t>(*it - '0');
+                }
+            }
+            if (it != last && *it == '.') {
+                ++it;
+                if (it == last || *it < '0' || *it > '9') {
+                    return false;
+                }
+                int precision = 0;
+                for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+                    precision = precision * 10 + (*it - '0');
+                    if (precision > charconv::kMaxPrecision) {
+                        return false;
+                    }
+                }
+                out.options.precision = precision;
+            }
+
+            char name[4] = {};
+            std::size_t size = 0;
+            for (; it != last && *it != '}'; ++it) {
+                if (size == sizeof(name)) {
+                    return false;
+                }
+                name[size++] = *it;
+            }
+            if (size == 0) {
+                return true;
+            }
+            if (equals("raw", name, size)) {
+                out.raw = true;
+                // precision only means something for floating-point reps
+                return TFloating || out.options.precision < 0;
+            }
+            if (equals("iB", name, size) || equals("sB", name, size)) {
+                out.options.scale = name[0] == 'i' ? scaling::iec : scaling::si;
+                return true;
+            }
+            for (int binary = 0; binary < 2; ++binary) {
+                for (int index = 0; index < 7; ++index) {
+                    if (equals(charconv::kSuffixNames[binary][index], name, size)) {
+                        out.target = { index, binary != 0 };
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        template <typename TRep, typename TRatio>
+        std::to_chars_result write(char* first, char* last, const unit<TRep, TRatio>& value, const spec& s) {
+            if (!s.raw) {
+                return charconv::to_chars(first, last, value, s.options, s.target);
+            }
+            if constexpr (is_integral_rep_v<TRep> && sizeof(TRep) > sizeof(std::uint64_t)) {
+#if defined(__SIZEOF_INT128__)
+                // std::to_chars only takes 128-bit integers in GNU modes
+                bool negative = false;
+                if constexpr (std::numeric_limits<TRep>::is_signed) {
+                    negative = value.value() < 0;
+                }
+                charconv::writer out{ first, last };
+                if (negative) {
+                    out.put('-');
+                }
+                out.put_uint(wide::magnitude(value.value(), negative));
+                return out.result();
+#endif
+            } else {
+                if constexpr (std::is_floating_point_v<TRep>) {
+                    if (s.options.precision >= 0) {
+                        return std::to_chars(
+                            first, last, value.value(), std::chars_format::fixed, s.options.precision
+                        );
+                    }
+                }
+                return std::to_chars(first, last, value.value());
+            }
+        }
+
+        /// Formats `value` into `out`, padded to the spec's width; throws `TError` if it can't be written
+        template <typename TError, typename TRep, typename TRatio, typename TOut>
+        TOut format(const unit<TRep, TRatio>& value, const spec& s, TOut out) {
+            char buf[charconv::kMaxChars<TRep>];
+            const auto res = write(buf, buf + sizeof(buf), value, s);
+            if (res.ec != std::errc{}) {
+                throw TError("digital unit too large to format");
+            }
+            const auto size = static_cast<std::size_t>(res.ptr - buf);
+            const std::size_t padding = s.width > size ? s.width - size : 0;
+            const std::size_t before = s.align == '>' ? padding : s.align == '^' ? padding / 2 : 0;
+            out = std::fill_n(out, before, s.fill);
+            out = std::copy(buf, res.ptr, out);
+            return std::fill_n(out, padding - before, s.fill);
+        }
+    } // namespace formatting
+} // namespace detail
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#if defined(PROX_DIGITAL_HAS_STD_FORMAT)
+template <typename TRep, typename TRatio>
+struct std::formatter<PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>, char> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (!PROX_DIGITAL_NAMESPACE_NAME::detail::formatting::parse<std::is_floating_point_v<TRep>>(
+                it, ctx.end(), mSpec
+            )) {
+            throw std::format_error("invalid format spec for a digital unit");
+        }
+        return it;
+    }
+
+    template <typename TContext>
+    auto format(const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>& value, TContext& ctx) const {
+        namespace df = PROX_DIGITAL_NAMESPACE_NAME::detail::formatting;
+        return df::format<std::format_error>(value, mSpec, ctx.out());
+    }
+
+private:
+    PROX_DIGITAL_NAMESPACE_NAME::detail::formatting::spec mSpec;
+};
+#endif
+
+#if defined(PROX_DIGITAL_HAS_FMT)
+template <typename TRep, typename TRatio>
+struct fmt::formatter<PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>, char> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (!PROX_DIGITAL_NAMESPACE_NAME::detail::formatting::parse<std::is_floating_point_v<TRep>>(
+                it, ctx.end(), mSpec
+            )) {
+            throw fmt::format_error("invalid format spec for a digital unit");
+        }
+        return it;
+    }
+
+    template <typename TContext>
+    auto format(const PROX_DIGITAL_NAMESPACE_NAME::unit<TRep, TRatio>& value, TContext& ctx) const {
+        namespace df = PROX_DIGITAL_NAMESPACE_NAME::detail::formatting;
+        return df::format<fmt::format_error>(value, mSpec, ctx.out());
+    }
+
+private:
+    PROX_DIGITAL_NAMESPACE_NAME::detail::formatting::spec mSpec;
+};
+#endif
+
+#endif // PROX_DIGITAL_FORMAT_HPP_
@@ -0,0 +1,260 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_GRANULAR_HPP_
+#define PROX_DIGITAL_GRANULAR_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Granularity tags of `granular_unit`, with the size in bytes used until `set_granularity` is called
+struct page_granularity {
+    static constexpr std::uint64_t default_bytes = 4'096;
+};
+
+struct huge_page_granularity {
+    static constexpr std::uint64_t default_bytes = 2 * 1'024 * 1'024;
+};
+
+struct fs_block_granularity {
+    static constexpr std::uint64_t default_bytes = 4'096;
+};
+
+template <typename TTag, typename TRep = std::int64_t>
+class granular_unit;
+
+namespace detail {
+    namespace granular {
+        template <typename T>
+        inline constexpr bool is_granular_v = false;
+
+        template <typename TTag, typename TRep>
+        inline constexpr bool is_granular_v<granular_unit<TTag, TRep>> = true;
+
+        /// A granularity in bytes, with a shift for powers of two and a multiplier for the rest. The
+        /// multiplier is the 65-bit `2^(64 + shift) / bytes` without its top bit (libdivide's "add" method).
+        struct granularity {
+            std::uint64_t bytes;
+            std::uint64_t magic;
+            unsigned shift;
+        };
+
+        constexpr granularity make_granularity(std::uint64_t bytes) {
+            unsigned shift = 0;
+            while ((std::uint64_t{ 1 } << shift) < bytes && shift < 63) {
+                ++shift;
+            }
+            if ((std::uint64_t{ 1 } << shift) == bytes) {
+                return { bytes, 0, shift };
+            }
+            // 2^(64 + shift) / bytes - 2^64, with 2^shift - bytes < bytes, so the quotient fits in 64 bits
+            const std::uint64_t excess = (std::uint64_t{ 1 } << shift) - bytes;
+            const std::uint64_t magic = wide::divide({ excess, 0 }, wide::make_divider(bytes));
+            return { bytes, magic + 1, shift };
+        }
+
+        template <typename TTag>
+        inline granularity state = make_granularity(TTag::default_bytes);
+
+        /// Quotient and whether it is exact, of a byte count by the granularity
+        struct division {
+            std::uint64_t quot;
+            bool exact;
+        };
+
+        inline division divide(std::int64_t n, const granularity& g) {
+            const auto bits = static_cast<std::uint64_t>(n);
+            const std::uint64_t magnitude = n < 0 ? 0U - bits : bits;
+            std::uint64_t quot = 0;
+            // the branch only depends on the granularity, which doesn't change after startup
+            if (g.magic == 0) {
+                quot = magnitude >> g.shift;
+            } else {
+                const std::uint64_t hi = wide::mul(magnitude, g.magic).hi;
+                quot = (((magnitude - hi) >> 1) + hi) >> (g.shift - 1);
+            }
+            return { quot, quot * g.bytes == magnitude };
+        }
+
+        enum class rounding { toward_zero, down, up };
+
+        template <typename TGranular, rounding TRounding, typename TRep, typename TRatio>
+        TGranular from_bytes(const unit<TRep, TRatio>& v) {
+            using TTag = typename TGranular::tag;
+            const std::int64_t n = PROX_DIGITAL_NAMESPACE_NAME::unit_cast<bytes>(v).value();
+            const division d = divide(n, state<TTag>);
+            auto quot = static_cast<std::int64_t>(d.quot);
+            if (n < 0) {
+                quot = -quot;
+            }
+            if constexpr (TRounding == rounding::down) {
+                quot -= n < 0 && !d.exact ? 1 : 0;
+            } else if constexpr (TRounding == rounding::up) {
+                quot += n > 0 && !d.exact ? 1 : 0;
+            }
+            return TGranular(static_cast<typename TGranular::rep>(quot));
+        }
+    } // namespace granular
+} // namespace detail
+
+/// A count of granules whose size is a runtime invariant, such as memory pages (`sysconf`) or
+/// filesystem blocks (`statvfs`). Set the size once at startup, before other threads use the unit.
+/// Converting from bytes shifts for power-of-two sizes and multiplies by a precomputed reciprocal
+/// otherwise; nothing goes through a hardware division.
+template <typename TTag, typename TRep>
+class granular_unit final {
+    static_assert(std::is_integral_v<TRep>, "granular_unit requires an integral representation");
+
+public:
+    using rep = TRep;
+    using tag = TTag;
+
+    /// Throws `std::invalid_argument` unless `size` is positive
+    static void set_granularity(bytes size) {
+        if (size.value() <= 0) {
+            throw std::invalid_argument("granularity must be positive");
+        }
+        detail::granular::state<TTag> =
+            detail::granular::make_granularity(static_cast<std::uint64_t>(size.value()));
+    }
+
+    [[nodiscard]] static bytes granularity() {
+        return bytes(static_cast<bytes::rep>(detail::granular::state<TTag>.bytes));
+    }
+
+    [[nodiscard]] static constexpr granular_unit zero() { return granular_unit(TRep{ 0 }); }
+
+    constexpr granular_unit() = default;
+
+    constexpr explicit granular_unit(TRep count)
+        : mCount(count) {}
+
+    [[nodiscard]] constexpr TRep value() const { return mCount; }
+
+    [[nodiscard]] constexpr granular_unit operator+() const { return *this; }
+
+    [[nodiscard]] constexpr granular_unit operator-() const {
+        return granular_unit(static_cast<TRep>(-mCount));
+    }
+
+    constexpr granular_unit& operator+=(const granular_unit& rhs) {
+        mCount = static_cast<TRep>(mCount + rhs.mCount);
+        return *this;
+    }
+
+    constexpr granular_unit& operator-=(const granular_unit& rhs) {
+        mCount = static_cast<TRep>(mCount - rhs.mCount);
+        return *this;
+    }
+
+    constexpr granular_unit& operator*=(const TRep& rhs) {
+        mCount = static_cast<TRep>(mCount * rhs);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr granular_unit operator+(granular_unit lhs, const granular_unit& rhs) {
+        return lhs += rhs;
+    }
+
+    [[nodiscard]] friend constexpr granular_unit operator-(granular_unit lhs, const granular_unit& rhs) {
+        return lhs -= rhs;
+    }
+
+    [[nodiscard]] friend constexpr granular_unit operator*(granular_unit lhs, const TRep& rhs) {
+        return lhs *= rhs;
+    }
+
+    [[nodiscard]] friend constexpr granular_unit operator*(const TRep& lhs, granular_unit rhs) {
+        return rhs *= lhs;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount == rhs.mCount;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount != rhs.mCount;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount < rhs.mCount;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount <= rhs.mCount;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount > rhs.mCount;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const granular_unit& lhs, const granular_unit& rhs) {
+        return lhs.mCount >= rhs.mCount;
+    }
+
+private:
+    TRep mCount = 0;
+};
+
+using pages = granular_unit<page_granularity>;
+using huge_pages = granular_unit<huge_page_granularity>;
+using fs_blocks = granular_unit<fs_block_granularity>;
+
+/// The size of `v` in `TTo`, e.g. `unit_cast<bytes>(pages(3))`
+template <typename TTo, typename TTag, typename TRep>
+[[nodiscard]] auto unit_cast(const granular_unit<TTag, TRep>& v)
+    -> std::enable_if_t<detail::is_specialization_of_v<TTo, unit>, TTo> {
+    const auto size = static_cast<std::int64_t>(v.value()) *
+                      static_cast<std::int64_t>(detail::granular::state<TTag>.bytes);
+    return unit_cast<TTo>(bytes(size));
+}
+
+/// The whole granules in `v`, truncated toward zero like `unit_cast` between units
+template <typename TTo, typename TRep, typename TRatio>
+[[nodiscard]] auto unit_cast(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::granular::is_granular_v<TTo>, TTo> {
+    return detail::granular::from_bytes<TTo, detail::granular::rounding::toward_zero>(v);
+}
+
+/// The greatest number of granules not larger than `v`
+template <typename TTo, typename TRep, typename TRatio>
+[[nodiscard]] auto floor(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::granular::is_granular_v<TTo>, TTo> {
+    return detail::granular::from_bytes<TTo, detail::granular::rounding::down>(v);
+}
+
+/// The smallest number of granules not smaller than `v`, e.g. the pages needed to hold `v`
+template <typename TTo, typename TRep, typename TRatio>
+[[nodiscard]] auto ceil(const unit<TRep, TRatio>& v)
+    -> std::enable_if_t<detail::granular::is_granular_v<TTo>, TTo> {
+    return detail::granular::from_bytes<TTo, detail::granular::rounding::up>(v);
+}
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_GRANULAR_HPP_
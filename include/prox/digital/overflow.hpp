@@ -0,0 +1,364 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_OVERFLOW_HPP_
+#define PROX_DIGITAL_OVERFLOW_HPP_
+
+#include <prox/digital.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PROX_DIGITAL_HAS_OVERFLOW_BUILTINS 1
+#define PROX_DIGITAL_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define PROX_DIGITAL_HAS_OVERFLOW_BUILTINS 0
+#define PROX_DIGITAL_UNLIKELY(x) (x)
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+/// Policies deciding what an `overflow_unit` operation yields when the exact result
+/// does not fit into the representation type
+namespace overflow {
+    /// Two's complement wrap-around, without the undefined behavior of signed overflow
+    struct wrapping {
+        template <typename TRep>
+        static constexpr TRep resolve(TRep wrapped, bool /* positive */) {
+            return wrapped;
+        }
+    };
+
+    /// Clamps the result to the representable range
+    struct saturating {
+        template <typename TRep>
+        static constexpr TRep resolve(TRep /* wrapped */, bool positive) {
+            return positive ? std::numeric_limits<TRep>::max() : std::numeric_limits<TRep>::lowest();
+        }
+    };
+
+    /// Throws `std::overflow_error`
+    struct checked {
+        template <typename TRep>
+        [[noreturn]] static TRep resolve(TRep /* wrapped */, bool positive) {
+            throw std::overflow_error(positive ? "digital unit overflow" : "digital unit underflow");
+        }
+    };
+
+    /// Terminates the program immediately
+    struct trapping {
+        template <typename TRep>
+        [[noreturn]] static TRep resolve(TRep /* wrapped */, bool /* positive */) {
+#if PROX_DIGITAL_HAS_OVERFLOW_BUILTINS
+            __builtin_trap();
+#else
+            std::abort();
+#endif
+        }
+    };
+} // namespace overflow
+
+namespace detail {
+    namespace overflow {
+        // Each operation stores the wrapped result in `out` and returns whether it overflowed.
+        template <typename T>
+        constexpr bool add(T a, T b, T& out) {
+#if PROX_DIGITAL_HAS_OVERFLOW_BUILTINS
+            return __builtin_add_overflow(a, b, &out);
+#else
+            using TUnsigned = std::make_unsigned_t<T>;
+            out = static_cast<T>(static_cast<TUnsigned>(a) + static_cast<TUnsigned>(b));
+            if constexpr (std::is_signed_v<T>) {
+                return ((a ^ out) & (b ^ out)) < 0;
+            } else {
+                return out < a;
+            }
+#endif
+        }
+
+        template <typename T>
+        constexpr bool sub(T a, T b, T& out) {
+#if PROX_DIGITAL_HAS_OVERFLOW_BUILTINS
+            return __builtin_sub_overflow(a, b, &out);
+#else
+            using TUnsigned = std::make_unsigned_t<T>;
+            out = static_cast<T>(static_cast<TUnsigned>(a) - static_cast<TUnsigned>(b));
+            if constexpr (std::is_signed_v<T>) {
+                return ((a ^ b) & (a ^ out)) < 0;
+            } else {
+                return b > a;
+            }
+#endif
+        }
+
+        template <typename T>
+        constexpr bool mul(T a, T b, T& out) {
+#if PROX_DIGITAL_HAS_OVERFLOW_BUILTINS
+            return __builtin_mul_overflow(a, b, &out);
+#else
+            using TUnsigned = std::make_unsigned_t<T>;
+            out = static_cast<T>(static_cast<TUnsigned>(a) * static_cast<TUnsigned>(b));
+            if (a == 0 || b == 0) {
+                return false;
+            }
+            if constexpr (std::is_signed_v<T>) {
+                if ((a == -1 && b == std::numeric_limits<T>::lowest()) ||
+                    (b == -1 && a == std::numeric_limits<T>::lowest())) {
+                    return true;
+                }
+            }
+            return out / b != a;
+#endif
+        }
+
+        template <typename T>
+        constexpr bool is_negative(T v) {
+            if constexpr (std::is_signed_v<T>) {
+                return v < 0;
+            } else {
+                return false;
+            }
+        }
+
+        /// `v * factor` wrapped to the width of `T`
+        template <typename T, typename TFrom>
+        constexpr T wrapped_mul(TFrom v, std::uintmax_t factor) {
+            return static_cast<T>(static_cast<std::uintmax_t>(v) * factor);
+        }
+    } // namespace overflow
+} // namespace detail
+
+/// A `unit` whose arithmetic detects overflow of the integral representation and resolves it
+/// according to `TPolicy` (one of the `overflow::` policies). The check is a single flag test
+/// per operation; plain `unit` arithmetic is left untouched.
+template <typename TUnit, typename TPolicy>
+class overflow_unit final {
+    static_assert(detail::is_specialization_of_v<TUnit, unit>, "TUnit must be a digital unit");
+    static_assert(std::is_integral_v<typename TUnit::rep>, "Overflow policies need an integral representation");
+
+public:
+    using unit_type = TUnit;
+    using policy = TPolicy;
+    using rep = typename TUnit::rep;
+    using ratio = typename TUnit::ratio;
+
+    [[nodiscard]] static constexpr overflow_unit zero() { return overflow_unit(TUnit::zero()); }
+    [[nodiscard]] static constexpr overflow_unit min() { return overflow_unit(TUnit::min()); }
+    [[nodiscard]] static constexpr overflow_unit max() { return overflow_unit(TUnit::max()); }
+
+    constexpr overflow_unit() = default;
+
+    constexpr explicit overflow_unit(const rep& v)
+        : mUnit(v) {}
+
+    constexpr overflow_unit(const TUnit& v)
+        : mUnit(v) {}
+
+    /// Converts from a unit that is a whole multiple of this one (KiB into B), applying the policy if
+    /// the scaled value doesn't fit
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<
+            !std::is_same_v<unit<TRep2, TRatio2>, TUnit> && std::is_integral_v<TRep2> &&
+                detail::is_harmonic<ratio, TRatio2>::value,
+            bool> = true>
+    constexpr overflow_unit(const unit<TRep2, TRatio2>& v)
+        : mUnit(convert(v)) {}
+
+    [[nodiscard]] constexpr rep value() const { return mUnit.value(); }
+
+    [[nodiscard]] constexpr const TUnit& get() const { return mUnit; }
+
+    constexpr operator TUnit() const { return mUnit; }
+
+    [[nodiscard]] constexpr overflow_unit operator+() const { return *this; }
+
+    [[nodiscard]] constexpr overflow_unit operator-() const { return zero() - *this; }
+
+    constexpr overflow_unit& operator++() { return *this += overflow_unit(rep(1)); }
+
+    constexpr overflow_unit operator++(int) {
+        const overflow_unit prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    constexpr overflow_unit& operator--() { return *this -= overflow_unit(rep(1)); }
+
+    constexpr overflow_unit operator--(int) {
+        const overflow_unit prev = *this;
+        --*this;
+        return prev;
+    }
+
+    constexpr overflow_unit& operator+=(const overflow_unit& rhs) {
+        rep out{};
+        if (PROX_DIGITAL_UNLIKELY(detail::overflow::add(value(), rhs.value(), out))) {
+            out = TPolicy::resolve(out, !detail::overflow::is_negative(rhs.value()));
+        }
+        mUnit = TUnit(out);
+        return *this;
+    }
+
+    constexpr overflow_unit& operator-=(const overflow_unit& rhs) {
+        rep out{};
+        if (PROX_DIGITAL_UNLIKELY(detail::overflow::sub(value(), rhs.value(), out))) {
+            out = TPolicy::resolve(out, detail::overflow::is_negative(rhs.value()));
+        }
+        mUnit = TUnit(out);
+        return *this;
+    }
+
+    constexpr overflow_unit& operator*=(const rep& rhs) {
+        rep out{};
+        if (PROX_DIGITAL_UNLIKELY(detail::overflow::mul(value(), rhs, out))) {
+            out = TPolicy::resolve(
+                out, detail::overflow::is_negative(value()) == detail::overflow::is_negative(rhs)
+            );
+        }
+        mUnit = TUnit(out);
+        return *this;
+    }
+
+    constexpr overflow_unit& operator/=(const rep& rhs) {
+        if constexpr (std::is_signed_v<rep>) {
+            if (PROX_DIGITAL_UNLIKELY(rhs == -1 && value() == std::numeric_limits<rep>::lowest())) {
+                mUnit = TUnit(TPolicy::resolve(value(), true));
+                return *this;
+            }
+        }
+        mUnit /= rhs;
+        return *this;
+    }
+
+    constexpr overflow_unit& operator%=(const rep& rhs) {
+        if constexpr (std::is_signed_v<rep>) {
+            if (rhs == -1) {
+                mUnit = TUnit::zero();
+                return *this;
+            }
+        }
+        mUnit %= rhs;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator+(overflow_unit lhs, const overflow_unit& rhs) {
+        return lhs += rhs;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator-(overflow_unit lhs, const overflow_unit& rhs) {
+        return lhs -= rhs;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator*(overflow_unit lhs, const rep& rhs) {
+        return lhs *= rhs;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator*(const rep& lhs, overflow_unit rhs) {
+        return rhs *= lhs;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator/(overflow_unit lhs, const rep& rhs) {
+        return lhs /= rhs;
+    }
+
+    [[nodiscard]] friend constexpr overflow_unit operator%(overflow_unit lhs, const rep& rhs) {
+        return lhs %= rhs;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() == rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() != rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() < rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() <= rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() > rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const overflow_unit& lhs, const overflow_unit& rhs) {
+        return lhs.value() >= rhs.value();
+    }
+
+private:
+    template <typename TRep2, typename TRatio2>
+    static constexpr TUnit convert(const unit<TRep2, TRatio2>& v) {
+        using TDivide = std::ratio_divide<TRatio2, ratio>;
+        constexpr auto kFactor = static_cast<std::uintmax_t>(TDivide::num);
+        const bool positive = !detail::overflow::is_negative(v.value());
+        if constexpr (kFactor > static_cast<std::uintmax_t>(std::numeric_limits<rep>::max())) {
+            // not even a single source unit fits
+            if (v.value() == 0) {
+                return TUnit(0);
+            }
+            return TUnit(TPolicy::resolve(detail::overflow::wrapped_mul<rep>(v.value(), kFactor), positive));
+        } else {
+            if (!detail::literal::aux::in_range<rep>(v.value())) {
+                const rep wrapped = detail::overflow::wrapped_mul<rep>(v.value(), kFactor);
+                return TUnit(TPolicy::resolve(wrapped, positive));
+            }
+            rep out{};
+            const auto factor = static_cast<rep>(kFactor);
+            if (PROX_DIGITAL_UNLIKELY(detail::overflow::mul(static_cast<rep>(v.value()), factor, out))) {
+                out = TPolicy::resolve(out, positive);
+            }
+            return TUnit(out);
+        }
+    }
+
+    TUnit mUnit;
+};
+
+template <typename TUnit>
+using checked_unit = overflow_unit<TUnit, overflow::checked>;
+
+template <typename TUnit>
+using saturating_unit = overflow_unit<TUnit, overflow::saturating>;
+
+template <typename TUnit>
+using wrapping_unit = overflow_unit<TUnit, overflow::wrapping>;
+
+template <typename TUnit>
+using trapping_unit = overflow_unit<TUnit, overflow::trapping>;
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#undef PROX_DIGITAL_UNLIKELY
+#undef PROX_DIGITAL_HAS_OVERFLOW_BUILTINS
+
+#endif // PROX_DIGITAL_OVERFLOW_HPP_
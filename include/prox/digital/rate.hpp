@@ -0,0 +1,302 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_RATE_HPP_
+#define PROX_DIGITAL_RATE_HPP_
+
+#include <prox/digital.hpp>
+
+#include <chrono>
+#include <ratio>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+template <typename TUnit, typename TPeriod = std::ratio<1>>
+class rate;
+
+namespace detail {
+    namespace rates {
+        /// A rate as a plain unit whose ratio is the number of bytes per second one count stands for;
+        /// conversions and comparisons between rates are those of these units
+        template <typename TRate>
+        using flat_unit_t =
+            unit<typename TRate::rep, aux::divide<typename TRate::unit_type::ratio, typename TRate::period>>;
+
+        template <typename TRate>
+        constexpr flat_unit_t<TRate> flatten(const TRate& r) {
+            return flat_unit_t<TRate>(r.value());
+        }
+
+        template <typename TFlat>
+        using rate_of_t = rate<std::remove_cv_t<TFlat>, std::ratio<1>>;
+    } // namespace rates
+} // namespace detail
+
+/// Converts between rates, truncating toward zero like `unit_cast`
+template <typename TToRate, typename TUnit, typename TPeriod>
+[[nodiscard]] constexpr auto rate_cast(const rate<TUnit, TPeriod>& from)
+    -> std::enable_if_t<detail::is_specialization_of_v<TToRate, rate>, TToRate> {
+    using TTo = detail::rates::flat_unit_t<TToRate>;
+    return TToRate(unit_cast<TTo>(detail::rates::flatten(from)).value());
+}
+
+/// An amount of `TUnit` per `TPeriod` seconds, e.g. `rate<mebibytes>` for MiB/s
+///
+/// Produced by dividing a unit by a `std::chrono::duration` (`100_MiB / 1s`). Conversions between
+/// rates are implicit only when exact, the same as between units.
+template <typename TUnit, typename TPeriod>
+class rate final {
+    static_assert(detail::is_specialization_of_v<TUnit, unit>, "TUnit must be a digital unit");
+    static_assert(TPeriod::num > 0, "The period must be positive");
+
+public:
+    using unit_type = TUnit;
+    using rep = typename TUnit::rep;
+    using period = typename TPeriod::type;
+
+    [[nodiscard]] static constexpr rate zero() { return rate(TUnit::zero().value()); }
+    [[nodiscard]] static constexpr rate min() { return rate(TUnit::min().value()); }
+    [[nodiscard]] static constexpr rate max() { return rate(TUnit::max().value()); }
+
+    constexpr rate() = default;
+
+    template <
+        typename TRep2,
+        std::enable_if_t<
+            std::is_convertible_v<const TRep2&, rep> &&
+                (std::is_floating_point_v<rep> || !std::is_floating_point_v<TRep2>),
+            bool> = true>
+    constexpr explicit rate(const TRep2& count)
+        : mValue(static_cast<rep>(count)) {}
+
+    template <
+        typename TUnit2,
+        typename TPeriod2,
+        typename TRep2 = typename TUnit2::rep,
+        std::enable_if_t<
+            std::is_convertible_v<const TRep2&, rep> &&
+                (std::is_floating_point_v<rep> ||
+                 (detail::is_harmonic<
+                      typename detail::rates::flat_unit_t<rate>::ratio,
+                      typename detail::rates::flat_unit_t<rate<TUnit2, TPeriod2>>::ratio>::value &&
+                  !std::is_floating_point_v<TRep2>)),
+            bool> = true>
+    constexpr rate(const rate<TUnit2, TPeriod2>& other)
+        : mValue(rate_cast<rate>(other).value()) {}
+
+    [[nodiscard]] constexpr rep value() const { return mValue; }
+
+    /// The amount per period
+    [[nodiscard]] constexpr TUnit amount() const { return TUnit(mValue); }
+
+    [[nodiscard]] constexpr rate operator+() const { return *this; }
+
+    [[nodiscard]] constexpr rate operator-() const { return rate(-mValue); }
+
+    constexpr rate& operator+=(const rate& rhs) {
+        mValue += rhs.mValue;
+        return *this;
+    }
+
+    constexpr rate& operator-=(const rate& rhs) {
+        mValue -= rhs.mValue;
+        return *this;
+    }
+
+    constexpr rate& operator*=(const rep& rhs) {
+        mValue *= rhs;
+        return *this;
+    }
+
+    constexpr rate& operator/=(const rep& rhs) {
+        mValue /= rhs;
+        return *this;
+    }
+
+private:
+    rep mValue;
+};
+
+using bytes_per_second = rate<bytes>;
+using kilobytes_per_second = rate<kilobytes>;
+using megabytes_per_second = rate<megabytes>;
+using gigabytes_per_second = rate<gigabytes>;
+using kibibytes_per_second = rate<kibibytes>;
+using mebibytes_per_second = rate<mebibytes>;
+using gibibytes_per_second = rate<gibibytes>;
+
+/// Comparison operators
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator==(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return detail::rates::flatten(lhs) == detail::rates::flatten(rhs);
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator!=(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return !(lhs == rhs);
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator<(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return detail::rates::flatten(lhs) < detail::rates::flatten(rhs);
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator<=(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return !(rhs < lhs);
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator>(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return rhs < lhs;
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr bool operator>=(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    return !(lhs < rhs);
+}
+
+/// Arithmetic operators
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr auto operator+(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    const auto sum = detail::rates::flatten(lhs) + detail::rates::flatten(rhs);
+    return detail::rates::rate_of_t<decltype(sum)>(sum.value());
+}
+
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+[[nodiscard]] constexpr auto operator-(
+    const rate<TUnit1, TPeriod1>& lhs,
+    const rate<TUnit2, TPeriod2>& rhs
+) {
+    const auto difference = detail::rates::flatten(lhs) - detail::rates::flatten(rhs);
+    return detail::rates::rate_of_t<decltype(difference)>(difference.value());
+}
+
+template <typename TUnit, typename TPeriod, typename TRep2>
+[[nodiscard]] constexpr auto operator*(const rate<TUnit, TPeriod>& lhs, const TRep2& rhs)
+    -> rate<std::remove_cv_t<decltype(lhs.amount() * rhs)>, TPeriod> {
+    return rate<std::remove_cv_t<decltype(lhs.amount() * rhs)>, TPeriod>((lhs.amount() * rhs).value());
+}
+
+template <typename TRep1, typename TUnit, typename TPeriod>
+[[nodiscard]] constexpr auto operator*(const TRep1& lhs, const rate<TUnit, TPeriod>& rhs)
+    -> decltype(rhs * lhs) {
+    return rhs * lhs;
+}
+
+template <typename TUnit, typename TPeriod, typename TRep2>
+[[nodiscard]] constexpr auto operator/(const rate<TUnit, TPeriod>& lhs, const TRep2& rhs)
+    -> rate<std::remove_cv_t<decltype(lhs.amount() / rhs)>, TPeriod> {
+    return rate<std::remove_cv_t<decltype(lhs.amount() / rhs)>, TPeriod>((lhs.amount() / rhs).value());
+}
+
+/// Amount per duration; integral reps truncate like dividing a unit by a number
+template <typename TRep1, typename TRatio1, typename TRep2, typename TPeriod2>
+[[nodiscard]] constexpr auto
+operator/(const unit<TRep1, TRatio1>& amount, const std::chrono::duration<TRep2, TPeriod2>& time)
+    -> rate<unit<std::common_type_t<TRep1, TRep2>, TRatio1>, TPeriod2> {
+    using TCRep = std::common_type_t<TRep1, TRep2>;
+    return rate<unit<TCRep, TRatio1>, TPeriod2>(
+        static_cast<TCRep>(amount.value()) / static_cast<TCRep>(time.count())
+    );
+}
+
+/// Amount transferred over a duration, exact: the result's ratio absorbs the duration's period
+template <typename TUnit, typename TPeriod, typename TRep2, typename TPeriod2>
+[[nodiscard]] constexpr auto operator*(
+    const rate<TUnit, TPeriod>& speed,
+    const std::chrono::duration<TRep2, TPeriod2>& time
+) {
+    using TCRep = std::common_type_t<typename TUnit::rep, TRep2>;
+    using TRatio = std::ratio_multiply<typename TUnit::ratio, detail::aux::divide<TPeriod2, TPeriod>>;
+    return unit<TCRep, typename TRatio::type>(
+        static_cast<TCRep>(speed.value()) * static_cast<TCRep>(time.count())
+    );
+}
+
+template <typename TRep1, typename TPeriod1, typename TUnit, typename TPeriod>
+[[nodiscard]] constexpr auto operator*(
+    const std::chrono::duration<TRep1, TPeriod1>& time,
+    const rate<TUnit, TPeriod>& speed
+) {
+    return speed * time;
+}
+
+/// Time needed to transfer an amount, as a floating-point count of the rate's period so that transfers
+/// shorter than one period don't truncate to zero; `std::chrono::ceil` it for a whole number of ticks
+template <typename TRep1, typename TRatio1, typename TUnit, typename TPeriod>
+[[nodiscard]] constexpr auto operator/(
+    const unit<TRep1, TRatio1>& amount,
+    const rate<TUnit, TPeriod>& speed
+) {
+    using TCT = std::common_type_t<unit<TRep1, TRatio1>, TUnit>;
+    using TFloat = std::common_type_t<typename TCT::rep, double>;
+    using TDuration = std::chrono::duration<TFloat, TPeriod>;
+    return TDuration(
+        static_cast<TFloat>(unit_cast<TCT>(amount).value()) /
+        static_cast<TFloat>(unit_cast<TCT>(speed.amount()).value())
+    );
+}
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+namespace std {
+template <typename TUnit1, typename TPeriod1, typename TUnit2, typename TPeriod2>
+struct common_type<
+    PROX_DIGITAL_NAMESPACE_NAME::rate<TUnit1, TPeriod1>,
+    PROX_DIGITAL_NAMESPACE_NAME::rate<TUnit2, TPeriod2>> {
+private:
+    using TRate1 = PROX_DIGITAL_NAMESPACE_NAME::rate<TUnit1, TPeriod1>;
+    using TRate2 = PROX_DIGITAL_NAMESPACE_NAME::rate<TUnit2, TPeriod2>;
+
+public:
+    using type = PROX_DIGITAL_NAMESPACE_NAME::detail::rates::rate_of_t<common_type_t<
+        PROX_DIGITAL_NAMESPACE_NAME::detail::rates::flat_unit_t<TRate1>,
+        PROX_DIGITAL_NAMESPACE_NAME::detail::rates::flat_unit_t<TRate2>>>;
+};
+} // namespace std
+
+#endif // PROX_DIGITAL_RATE_HPP_
@@ -0,0 +1,179 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_SHARDED_COUNTER_HPP_
+#define PROX_DIGITAL_SHARDED_COUNTER_HPP_
+
+#include <prox/digital.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sched.h>
+#define PROX_DIGITAL_HAS_SCHED_GETCPU 1
+#else
+#define PROX_DIGITAL_HAS_SCHED_GETCPU 0
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+namespace detail {
+    namespace sharding {
+        /// Destructive interference size; fixed so the layout doesn't depend on compiler flags
+        inline constexpr std::size_t kCacheLineSize = 64;
+
+        inline std::size_t shard_count_for(std::size_t requested) {
+            std::size_t n = requested != 0 ? requested : std::thread::hardware_concurrency();
+            std::size_t pow2 = 1;
+            while (pow2 < n) {
+                pow2 <<= 1;
+            }
+            return pow2;
+        }
+
+        /// A small per-thread number, handed out round-robin so threads spread evenly over shards
+        inline std::size_t thread_slot() {
+            static std::atomic<std::size_t> next{ 0 };
+            thread_local const std::size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+        }
+
+        /// The CPU the caller currently runs on (served from rseq/vDSO by modern glibc),
+        /// or the thread's slot where that isn't available
+        inline std::size_t current_shard() {
+#if PROX_DIGITAL_HAS_SCHED_GETCPU
+            const int cpu = ::sched_getcpu();
+            if (cpu >= 0) {
+                return static_cast<std::size_t>(cpu);
+            }
+#endif
+            return thread_slot();
+        }
+    } // namespace sharding
+} // namespace detail
+
+/// A counter of `TUnit` split into cache-line-padded per-CPU shards
+///
+/// `add()` touches only the shard of the CPU the caller runs on, so concurrent updates from many
+/// cores don't contend on a single cache line. `read()` folds all shards without holding writers
+/// back: it is exact once updates have quiesced, while they are in flight it sums per-shard values
+/// that need not have coexisted. With only non-negative updates in flight, successive reads never
+/// decrease and never exceed the final total. There is deliberately no exact concurrent snapshot:
+/// it would need every update to publish a version next to the value (a seqlock or epoch), adding
+/// read-modify-writes to the one-instruction update path this counter exists for. `drain()`
+/// atomically moves each shard's value out, so successive drains account for every update exactly
+/// once.
+template <typename TUnit>
+class sharded_counter final {
+    static_assert(detail::is_specialization_of_v<TUnit, unit>, "TUnit must be a digital unit");
+    static_assert(std::is_integral_v<typename TUnit::rep>, "sharded_counter needs an integral representation");
+
+public:
+    using unit_type = TUnit;
+    using rep = typename TUnit::rep;
+    using ratio = typename TUnit::ratio;
+
+    /// Creates a counter with `shards` shards rounded up to a power of two (one per hardware thread by default)
+    explicit sharded_counter(std::size_t shards = 0)
+        : mMask(detail::sharding::shard_count_for(shards) - 1)
+        , mShards(std::make_unique<shard[]>(mMask + 1)) {}
+
+    sharded_counter(const sharded_counter&) = delete;
+
+    sharded_counter& operator=(const sharded_counter&) = delete;
+
+    ~sharded_counter() = default;
+
+    [[nodiscard]] std::size_t shards() const noexcept { return mMask + 1; }
+
+    /// Adds `delta`, which may be any unit that converts into `TUnit` exactly
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<std::is_integral_v<TRep2> && detail::is_harmonic<ratio, TRatio2>::value, bool> = true>
+    void add(const unit<TRep2, TRatio2>& delta) noexcept {
+        local().value.fetch_add(TUnit(delta).value(), std::memory_order_relaxed);
+    }
+
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<std::is_integral_v<TRep2> && detail::is_harmonic<ratio, TRatio2>::value, bool> = true>
+    void sub(const unit<TRep2, TRatio2>& delta) noexcept {
+        local().value.fetch_sub(TUnit(delta).value(), std::memory_order_relaxed);
+    }
+
+    template <typename TRep2, typename TRatio2>
+    sharded_counter& operator+=(const unit<TRep2, TRatio2>& delta) noexcept {
+        add(delta);
+        return *this;
+    }
+
+    template <typename TRep2, typename TRatio2>
+    sharded_counter& operator-=(const unit<TRep2, TRatio2>& delta) noexcept {
+        sub(delta);
+        return *this;
+    }
+
+    /// Sum of all shards; exact once updates have quiesced
+    [[nodiscard]] TUnit read() const noexcept {
+        rep total{};
+        for (std::size_t i = 0; i <= mMask; ++i) {
+            total = wrapping_add(total, mShards[i].value.load(std::memory_order_relaxed));
+        }
+        return TUnit(total);
+    }
+
+    /// Takes the value out of every shard, leaving the counter at zero
+    TUnit drain() noexcept {
+        rep total{};
+        for (std::size_t i = 0; i <= mMask; ++i) {
+            total = wrapping_add(total, mShards[i].value.exchange(rep{}, std::memory_order_acq_rel));
+        }
+        return TUnit(total);
+    }
+
+private:
+    struct alignas(detail::sharding::kCacheLineSize) shard {
+        std::atomic<rep> value{};
+    };
+
+    static rep wrapping_add(rep lhs, rep rhs) noexcept {
+        using TUnsigned = std::make_unsigned_t<rep>;
+        return static_cast<rep>(static_cast<TUnsigned>(lhs) + static_cast<TUnsigned>(rhs));
+    }
+
+    shard& local() noexcept { return mShards[detail::sharding::current_shard() & mMask]; }
+
+    std::size_t mMask;
+    std::unique_ptr<shard[]> mShards;
+};
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_SHARDED_COUNTER_HPP_
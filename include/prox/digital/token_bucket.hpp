@@ -0,0 +1,227 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_TOKEN_BUCKET_HPP_
+#define PROX_DIGITAL_TOKEN_BUCKET_HPP_
+
+#include <prox/digital.hpp>
+#include <prox/digital/rate.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+namespace detail {
+    namespace throttling {
+        /// Costs are capped so that adding one to a timestamp can't overflow
+        inline constexpr std::uint64_t kMaxCost = std::uint64_t{ 1 } << 62;
+
+        /// ceil(n * num / den), saturated to `kMaxCost`
+        inline std::uint64_t mul_div_ceil(std::uint64_t n, std::uint64_t num, std::uint64_t den) {
+#if defined(__SIZEOF_INT128__)
+            using TWide = wide::int128<std::uint64_t>::type;
+            const TWide q = (static_cast<TWide>(n) * num + (den - 1)) / den;
+            return q > kMaxCost ? kMaxCost : static_cast<std::uint64_t>(q);
+#else
+            const long double q = static_cast<long double>(n / den) * static_cast<long double>(num) +
+                                  std::ceil(static_cast<long double>(n % den) * num / den);
+            return q > static_cast<long double>(kMaxCost) ? kMaxCost : static_cast<std::uint64_t>(q);
+#endif
+        }
+    } // namespace throttling
+} // namespace detail
+
+/// A lock-free token bucket holding up to `capacity` bytes and refilled at a constant `rate`
+///
+/// Implemented as GCRA: the whole state is a single atomic "theoretical arrival time" in
+/// nanoseconds, which each consumption pushes forward by the time its bytes take to refill. A
+/// consumption fits while that time stays within one full bucket's refill time of now.
+template <typename TClock = std::chrono::steady_clock>
+class token_bucket final {
+public:
+    using clock = TClock;
+    using time_point = typename TClock::time_point;
+    using duration = typename TClock::duration;
+
+    /// Creates a bucket with `capacity` bytes refilled at `refill`; the bucket starts full unless `full`
+    /// is false. Throws `std::invalid_argument` unless the rate is positive.
+    template <typename TUnit, typename TPeriod>
+    token_bucket(bytes capacity, const rate<TUnit, TPeriod>& refill, bool full = true)
+        : mStart(TClock::now()) {
+        using TRatio = typename detail::rates::flat_unit_t<rate<TUnit, TPeriod>>::ratio;
+        if (!(refill.value() > 0)) {
+            throw std::invalid_argument("the refill rate must be positive");
+        }
+        // nanoseconds per byte = 1e9 * den / (value * num)
+        std::uint64_t num = std::uint64_t{ 1000000000 } * static_cast<std::uint64_t>(TRatio::den);
+        std::uint64_t den = 0;
+        if constexpr (std::is_floating_point_v<typename TUnit::rep>) {
+            // fractional rates keep up to 32 fractional bits of the cost instead of truncating the rate
+            constexpr auto kMaxCost = static_cast<long double>(detail::throttling::kMaxCost);
+            const long double perByte = static_cast<long double>(num) /
+                                        static_cast<long double>(refill.value()) /
+                                        static_cast<long double>(TRatio::num);
+            int shift = 32;
+            while (shift > 0 && std::ldexp(perByte, shift) > kMaxCost) {
+                --shift;
+            }
+            const long double scaled = std::ceil(std::ldexp(perByte, shift));
+            num = scaled < kMaxCost ? static_cast<std::uint64_t>(scaled) : detail::throttling::kMaxCost;
+            den = std::uint64_t{ 1 } << shift;
+        } else {
+            den = static_cast<std::uint64_t>(refill.value()) * static_cast<std::uint64_t>(TRatio::num);
+        }
+        const std::uint64_t gcd = std::gcd(num, den);
+        mNsNum = num / gcd;
+        mNsDen = den / gcd;
+        mCapacity = capacity;
+        mTolerance = cost(capacity);
+        mTat.store(full ? 0 : static_cast<std::int64_t>(mTolerance), std::memory_order_relaxed);
+    }
+
+    token_bucket(const token_bucket&) = delete;
+
+    token_bucket& operator=(const token_bucket&) = delete;
+
+    ~token_bucket() = default;
+
+    [[nodiscard]] bytes capacity() const noexcept { return mCapacity; }
+
+    /// Takes `amount` out of the bucket if it holds that much right now
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<
+            std::is_integral_v<TRep2> && detail::is_harmonic<std::ratio<1>, TRatio2>::value,
+            bool> = true>
+    [[nodiscard]] bool try_consume(const unit<TRep2, TRatio2>& amount) noexcept {
+        const std::int64_t c = static_cast<std::int64_t>(cost(bytes(amount)));
+        const std::int64_t now = elapsed();
+        std::int64_t tat = mTat.load(std::memory_order_relaxed);
+        for (;;) {
+            const std::int64_t next = (tat > now ? tat : now) + c;
+            if (next - now > static_cast<std::int64_t>(mTolerance)) {
+                return false;
+            }
+            if (mTat.compare_exchange_weak(tat, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    /// Unconditionally takes `amount`, possibly into debt, and returns when the bucket will have
+    /// held it; callers waiting asynchronously schedule their continuation for that point
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<
+            std::is_integral_v<TRep2> && detail::is_harmonic<std::ratio<1>, TRatio2>::value,
+            bool> = true>
+    time_point reserve(const unit<TRep2, TRatio2>& amount) noexcept {
+        const std::int64_t c = static_cast<std::int64_t>(cost(bytes(amount)));
+        const std::int64_t now = elapsed();
+        std::int64_t tat = mTat.load(std::memory_order_relaxed);
+        std::int64_t next = 0;
+        do {
+            next = (tat > now ? tat : now) + c;
+        } while (
+            !mTat.compare_exchange_weak(tat, next, std::memory_order_acq_rel, std::memory_order_relaxed)
+        );
+        const std::int64_t ready = next - static_cast<std::int64_t>(mTolerance);
+        const std::chrono::nanoseconds at(ready > now ? ready : now);
+        return mStart + std::chrono::duration_cast<duration>(at);
+    }
+
+    /// Blocks until `amount` can be taken, then takes it
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<
+            std::is_integral_v<TRep2> && detail::is_harmonic<std::ratio<1>, TRatio2>::value,
+            bool> = true>
+    void consume(const unit<TRep2, TRatio2>& amount) {
+        std::this_thread::sleep_until(reserve(amount));
+    }
+
+    /// Time until `amount` could be taken, zero if it could be taken now
+    template <
+        typename TRep2,
+        typename TRatio2,
+        std::enable_if_t<
+            std::is_integral_v<TRep2> && detail::is_harmonic<std::ratio<1>, TRatio2>::value,
+            bool> = true>
+    [[nodiscard]] std::chrono::nanoseconds wait_time(const unit<TRep2, TRatio2>& amount) const noexcept {
+        const std::int64_t now = elapsed();
+        const std::int64_t tat = mTat.load(std::memory_order_relaxed);
+        const std::int64_t next = (tat > now ? tat : now) + static_cast<std::int64_t>(cost(bytes(amount)));
+        const std::int64_t wait = next - static_cast<std::int64_t>(mTolerance) - now;
+        return std::chrono::nanoseconds(wait > 0 ? wait : 0);
+    }
+
+    /// Bytes the bucket currently holds (a snapshot under concurrent use)
+    [[nodiscard]] bytes available() const noexcept {
+        const std::int64_t now = elapsed();
+        const std::int64_t tat = mTat.load(std::memory_order_relaxed);
+        const std::int64_t debt = tat > now ? tat - now : 0;
+        const std::int64_t spare = static_cast<std::int64_t>(mTolerance) - debt;
+        if (spare <= 0) {
+            return bytes::zero();
+        }
+        // the largest amount whose cost fits into the spare time
+        const auto most = detail::throttling::mul_div_ceil(static_cast<std::uint64_t>(spare), mNsDen, mNsNum);
+        const auto fits = static_cast<std::int64_t>(cost(bytes(static_cast<std::int64_t>(most))) >
+                                                            static_cast<std::uint64_t>(spare)
+                                                        ? most - 1
+                                                        : most);
+        return bytes(fits < mCapacity.value() ? fits : mCapacity.value());
+    }
+
+private:
+    /// Nanoseconds `amount` bytes take to refill, rounded up so the rate is never exceeded
+    std::uint64_t cost(bytes amount) const noexcept {
+        const std::int64_t n = amount.value();
+        return n > 0 ? detail::throttling::mul_div_ceil(static_cast<std::uint64_t>(n), mNsNum, mNsDen) : 0;
+    }
+
+    std::int64_t elapsed() const noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(TClock::now() - mStart).count();
+    }
+
+    time_point mStart;
+    std::uint64_t mNsNum = 0;
+    std::uint64_t mNsDen = 1;
+    std::uint64_t mTolerance = 0;
+    bytes mCapacity;
+    std::atomic<std::int64_t> mTat{ 0 };
+};
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_TOKEN_BUCKET_HPP_
@@ -0,0 +1,120 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROX_DIGITAL_FWD_HPP_
+#define PROX_DIGITAL_FWD_HPP_
+
+// Forward declaration of `unit` and the common aliases, for headers that only name the types.
+// Include <prox/digital.hpp> to use them.
+
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+
+#ifndef PROX_DIGITAL_NAMESPACE_NAME
+#define PROX_DIGITAL_NAMESPACE_NAME prox::digital
+#endif
+
+namespace PROX_DIGITAL_NAMESPACE_NAME {
+
+template <typename TRep, typename TRatio = std::ratio<1>>
+class unit;
+
+namespace detail {
+    template <typename T, T TValue, std::size_t TExp>
+    struct pow;
+
+    template <typename T, T TValue>
+    struct pow<T, TValue, 1> {
+        static constexpr T value = TValue;
+    };
+
+    template <typename T, T TValue>
+    struct pow<T, TValue, 0> {
+        static constexpr T value = 1;
+    };
+
+    template <typename T, T TValue, std::size_t TExp>
+    struct pow {
+        static constexpr T value = TValue * pow<T, TValue, TExp - 1>::value;
+    };
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ using int128_t = __int128;
+    __extension__ using uint128_t = unsigned __int128;
+#endif
+} // namespace detail
+
+using identity = std::ratio<1>;
+
+using kilo = std::ratio<detail::pow<std::int64_t, 1000, 1>::value>;
+using mega = std::ratio<detail::pow<std::int64_t, 1000, 2>::value>;
+using giga = std::ratio<detail::pow<std::int64_t, 1000, 3>::value>;
+using tera = std::ratio<detail::pow<std::int64_t, 1000, 4>::value>;
+using peta = std::ratio<detail::pow<std::int64_t, 1000, 5>::value>;
+using exa = std::ratio<detail::pow<std::int64_t, 1000, 6>::value>;
+
+using kibi = std::ratio<detail::pow<std::int64_t, 1024, 1>::value>;
+using mebi = std::ratio<detail::pow<std::int64_t, 1024, 2>::value>;
+using gibi = std::ratio<detail::pow<std::int64_t, 1024, 3>::value>;
+using tebi = std::ratio<detail::pow<std::int64_t, 1024, 4>::value>;
+using pebi = std::ratio<detail::pow<std::int64_t, 1024, 5>::value>;
+using exbi = std::ratio<detail::pow<std::int64_t, 1024, 6>::value>;
+
+using bytes = unit<std::int64_t, identity>;
+using kilobytes = unit<std::int64_t, kilo>;
+using megabytes = unit<std::int64_t, mega>;
+using gigabytes = unit<std::int64_t, giga>;
+using terabytes = unit<std::int64_t, tera>;
+using petabytes = unit<std::int64_t, peta>;
+using exabytes = unit<std::int64_t, exa>;
+
+using kibibytes = unit<std::int64_t, kibi>;
+using mebibytes = unit<std::int64_t, mebi>;
+using gibibytes = unit<std::int64_t, gibi>;
+using tebibytes = unit<std::int64_t, tebi>;
+using pebibytes = unit<std::int64_t, pebi>;
+using exbibytes = unit<std::int64_t, exbi>;
+
+#if defined(__SIZEOF_INT128__)
+/// 128-bit units for totals beyond the range of the 64-bit aliases
+using wide_bytes = unit<detail::int128_t, identity>;
+using wide_kilobytes = unit<detail::int128_t, kilo>;
+using wide_megabytes = unit<detail::int128_t, mega>;
+using wide_gigabytes = unit<detail::int128_t, giga>;
+using wide_terabytes = unit<detail::int128_t, tera>;
+using wide_petabytes = unit<detail::int128_t, peta>;
+using wide_exabytes = unit<detail::int128_t, exa>;
+
+using wide_kibibytes = unit<detail::int128_t, kibi>;
+using wide_mebibytes = unit<detail::int128_t, mebi>;
+using wide_gibibytes = unit<detail::int128_t, gibi>;
+using wide_tebibytes = unit<detail::int128_t, tebi>;
+using wide_pebibytes = unit<detail::int128_t, pebi>;
+using wide_exbibytes = unit<detail::int128_t, exbi>;
+#endif
+
+} // namespace PROX_DIGITAL_NAMESPACE_NAME
+
+#endif // PROX_DIGITAL_FWD_HPP_
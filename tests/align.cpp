@@ -0,0 +1,152 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/align.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+using pages = digital::unit<std::int64_t, std::ratio<4'096>>;
+} // namespace
+
+TEST_CASE("align_up / align_down") {
+    static_assert(digital::align_up<digital::kibibytes>(1_B) == 1_KiB);
+    static_assert(digital::align_up<digital::kibibytes>(1'024_B) == 1_KiB);
+    static_assert(digital::align_up<digital::kibibytes>(0_B) == 0_B);
+    static_assert(digital::align_up<pages>(4'097_B) == 8_KiB);
+    static_assert(digital::align_down<pages>(8'191_B) == 4_KiB);
+    static_assert(digital::align_down<digital::mebibytes>(1'535_KiB) == 1_MiB);
+    static_assert(digital::align_up<digital::mebibytes>(1'535_KiB) == 2_MiB);
+
+    // the result stays in the aligned unit
+    static_assert(std::is_same_v<decltype(digital::align_up<pages>(1_KiB)), digital::kibibytes>);
+    static_assert(digital::align_up<pages>(1_KiB) == 4_KiB);
+
+    // negative values round like `floor` and `ceil`
+    static_assert(digital::align_down<digital::kibibytes>(-1_B) == -1_KiB);
+    static_assert(digital::align_up<digital::kibibytes>(-1_B) == 0_B);
+    static_assert(digital::align_up<digital::kibibytes>(-1'025_B) == -1_KiB);
+    static_assert(digital::align_down<digital::kibibytes>(-1'025_B) ==
+                  digital::floor<digital::kibibytes>(-1'025_B));
+
+    // granularity values
+    static_assert(digital::align_up(5'000_B, 4_KiB) == 8'192_B);
+    static_assert(digital::align_down(5'000_B, 4_KiB) == 4'096_B);
+    static_assert(digital::align_up(3_MiB, 2_MiB) == 4_MiB);
+    static_assert(digital::align_up(3_MiB, 1_MiB) == 3_MiB);
+    static_assert(digital::align_up(digital::unit<std::uint32_t>(5), 8_B).value() == 8U);
+    static_assert(digital::align_down(digital::unit<std::uint16_t>(65'535), 4_KiB).value() == 61'440U);
+
+    for (std::int64_t v = -10'000; v <= 10'000; v += 37) {
+        const digital::bytes b(v);
+        CHECK(digital::align_up(b, 4_KiB) == digital::ceil<pages>(b));
+        CHECK(digital::align_down(b, 4_KiB) == digital::floor<pages>(b));
+        CHECK(digital::align_up<pages>(b) == digital::align_up(b, 4_KiB));
+    }
+
+    // granularities that aren't powers of two would give wrong masks
+    CHECK_THROWS_AS((void)digital::align_up(1'000_B, 3_KiB), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::align_down(1'000_B, 0_B), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::is_aligned(1'000_B, -4_KiB), std::invalid_argument);
+    const digital::bytes range[] = { 1_KiB, 2_KiB };
+    digital::bytes out[2];
+    CHECK_THROWS_AS(digital::align_up(std::begin(range), std::end(range), out, 24_B), std::invalid_argument);
+}
+
+TEST_CASE("is_aligned") {
+    static_assert(digital::is_aligned<pages>(8_KiB));
+    static_assert(!digital::is_aligned<pages>(9_KiB));
+    static_assert(digital::is_aligned<digital::kibibytes>(-2'048_B));
+    static_assert(digital::is_aligned(0_B, 4_KiB));
+    static_assert(digital::is_aligned(12_GiB, 4_GiB));
+    static_assert(!digital::is_aligned(12_GiB, 8_GiB));
+    static_assert(!digital::is_aligned(4'095_B, 4_KiB));
+}
+
+TEST_CASE("bit_ceil / bit_floor / log2") {
+    static_assert(digital::bit_ceil(3_KiB) == 4_KiB);
+    static_assert(digital::bit_ceil(4_KiB) == 4_KiB);
+    static_assert(digital::bit_ceil(0_B) == 1_B);
+    static_assert(digital::bit_ceil(-5_B) == 1_B);
+    static_assert(digital::bit_ceil(4'097_B) == 8'192_B);
+    static_assert(digital::bit_ceil(digital::unit<std::uint64_t>(std::uint64_t{ 1 } << 63)).value() ==
+                  std::uint64_t{ 1 } << 63);
+
+    static_assert(digital::bit_floor(3_KiB) == 2_KiB);
+    static_assert(digital::bit_floor(1_B) == 1_B);
+    static_assert(digital::bit_floor(0_B) == 0_B);
+    static_assert(digital::bit_floor(digital::bytes::max()).value() == std::int64_t{ 1 } << 62);
+
+    static_assert(digital::log2(1_B) == 0);
+    static_assert(digital::log2(4_KiB) == 2);
+    static_assert(digital::log2(4'096_B) == 12);
+    static_assert(digital::log2(4'097_B) == 12);
+    static_assert(digital::log2(digital::bytes::max()) == 62);
+}
+
+TEST_CASE("aligning ranges") {
+    const std::vector<digital::bytes> in = {
+        0_B, 1_B, 4'095_B, 4'096_B, 4'097_B, -1_B, 1_MiB, 12'345_B, 9_B,
+    };
+    std::vector<digital::bytes> out(in.size());
+
+    CHECK(digital::align_up(in.data(), in.data() + in.size(), out.data(), 4_KiB) == out.data() + out.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        CHECK(out[i] == digital::align_up(in[i], 4_KiB));
+    }
+    CHECK(digital::is_aligned(out.data(), out.data() + out.size(), 4_KiB));
+    CHECK(!digital::is_aligned(in.data(), in.data() + in.size(), 4_KiB));
+
+    digital::align_down(in.data(), in.data() + in.size(), out.data(), 4_KiB);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        CHECK(out[i] == digital::align_down(in[i], 4_KiB));
+    }
+
+    // in place
+    std::vector<digital::bytes> inPlace = in;
+    digital::align_up(inPlace.data(), inPlace.data() + inPlace.size(), inPlace.data(), 512_B);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        CHECK(inPlace[i] == digital::align_up(in[i], 512_B));
+    }
+
+#if defined(__cpp_lib_span)
+    std::vector<digital::bytes> spanOut(in.size() + 2);
+    const auto written = digital::align_up(std::span<const digital::bytes>(in), std::span(spanOut), 4_KiB);
+    CHECK(written.size() == in.size());
+    CHECK(digital::is_aligned(written, 4_KiB));
+    CHECK(digital::align_down(std::span(inPlace), std::span(inPlace), 4_KiB).size() == in.size());
+    CHECK(digital::is_aligned(std::span(inPlace), 4_KiB));
+    std::vector<digital::bytes> shorter(in.size() - 1);
+    CHECK_THROWS_AS(digital::align_up(std::span(in), std::span(shorter), 4_KiB), std::invalid_argument);
+    CHECK_THROWS_AS(digital::align_down(std::span(in), std::span(shorter), 4_KiB), std::invalid_argument);
+#endif
+}
@@ -0,0 +1,123 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/atomic.hpp>
+
+#include <doctest/doctest.h>
+
+#include <thread>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+TEST_CASE("atomic_unit basic operations") {
+    static_assert(digital::atomic_bytes::is_always_lock_free);
+    digital::atomic_bytes counter;
+    CHECK(counter.is_lock_free());
+    CHECK(counter.load() == 0_B);
+
+    CHECK(counter.fetch_add(1_KiB) == 0_B);
+    CHECK(counter.load() == 1024_B);
+    CHECK((counter += 1_MB) == 1001024_B);
+    CHECK(counter.fetch_sub(1_MB) == 1001024_B);
+    CHECK((counter -= 24_B) == 1000_B);
+    CHECK(++counter == 1001_B);
+    CHECK(counter-- == 1001_B);
+    CHECK(counter.load() == 1000_B);
+
+    CHECK(counter.exchange(5_B) == 1000_B);
+    counter = 7_B;
+    CHECK(static_cast<digital::bytes>(counter) == 7_B);
+
+    digital::bytes expected = 6_B;
+    CHECK_FALSE(counter.compare_exchange_strong(expected, 9_B));
+    CHECK(expected == 7_B);
+    CHECK(counter.compare_exchange_strong(expected, 9_B));
+    CHECK(counter.load() == 9_B);
+    while (!counter.compare_exchange_weak(expected, 11_B)) {
+    }
+    CHECK(counter.load() == 11_B);
+
+    digital::atomic_unit<std::int64_t, digital::kibi> kib(2_KiB);
+    kib += 1_MiB;
+    CHECK(kib.load() == 1026_KiB);
+}
+
+TEST_CASE("atomic_unit peak tracking") {
+    digital::atomic_bytes counter(10_B);
+    CHECK(counter.peak() == 10_B);
+    counter += 90_B;
+    counter -= 50_B;
+    CHECK(counter.peak() == 100_B);
+    counter.store(70_B);
+    CHECK(counter.peak() == 100_B);
+    CHECK(counter.epoch() == 0);
+
+    const auto closed = counter.reset_peak();
+    CHECK(closed.peak == 100_B);
+    CHECK(closed.epoch == 0);
+    CHECK(counter.epoch() == 1);
+    CHECK(counter.peak() == 70_B);
+
+    counter -= 60_B;
+    counter += 20_B;
+    CHECK(counter.peak() == 70_B);
+    counter.exchange(80_B);
+    CHECK(counter.peak() == 80_B);
+}
+
+TEST_CASE("atomic_unit concurrent updates") {
+    digital::atomic_bytes counter;
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.push_back(std::thread([&counter] {
+            for (int i = 0; i < kIterations; ++i) {
+                counter += 1_KiB;
+                counter -= 1023_B;
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(counter.load() == digital::bytes(kThreads * kIterations));
+    CHECK(counter.peak() >= counter.load());
+    CHECK(counter.peak() <= digital::bytes(kThreads * kIterations + kThreads * 1024));
+}
+
+#if defined(__cpp_lib_atomic_wait)
+TEST_CASE("atomic_unit wait and notify") {
+    digital::atomic_bytes counter;
+    std::thread producer([&counter] {
+        counter += 4_KiB;
+        counter.notify_all();
+    });
+    counter.wait(0_B);
+    CHECK(counter.load() == 4_KiB);
+    producer.join();
+}
+#endif
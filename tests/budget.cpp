@@ -0,0 +1,174 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/budget.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+TEST_CASE("budget reservations") {
+    digital::budget quota(1_KiB);
+    CHECK(quota.limit() == 1024_B);
+    CHECK(quota.try_reserve(1000_B));
+    CHECK(quota.used() == 1000_B);
+    CHECK(quota.available() == 24_B);
+    CHECK_FALSE(quota.try_reserve(25_B));
+    CHECK(quota.try_reserve(24_B));
+    CHECK_FALSE(quota.try_reserve(1_B));
+    quota.release(1_KB);
+    CHECK(quota.used() == 24_B);
+    CHECK(quota.try_reserve(1_KB));
+
+    quota.set_limit(512_B);
+    CHECK(quota.available() == 0_B);
+    CHECK_FALSE(quota.try_reserve(1_B));
+    quota.release(1024_B);
+    CHECK(quota.try_reserve(512_B));
+
+    digital::budget<digital::kibibytes> kib(digital::kibibytes(4));
+    CHECK(kib.try_reserve(2_MiB) == false);
+    CHECK(kib.try_reserve(4_KiB));
+}
+
+TEST_CASE("budget hierarchy") {
+    digital::budget process(10_KiB);
+    digital::budget tenant(6_KiB, &process);
+    digital::budget request(4_KiB, &tenant);
+    digital::budget other(8_KiB, &process);
+    CHECK(request.parent() == &tenant);
+
+    CHECK(request.try_reserve(3_KiB));
+    CHECK(tenant.used() == 3_KiB);
+    CHECK(process.used() == 3_KiB);
+
+    CHECK(other.try_reserve(6_KiB));
+    CHECK(process.used() == 9_KiB);
+
+    // fits the request and tenant, but not the process: nothing stays charged
+    CHECK_FALSE(request.try_reserve(1_KiB + 1_B));
+    CHECK(request.used() == 3_KiB);
+    CHECK(tenant.used() == 3_KiB);
+    CHECK(process.used() == 9_KiB);
+
+    CHECK(request.try_reserve(1_KiB));
+    CHECK(process.available() == 0_B);
+
+    request.release(4_KiB);
+    CHECK(tenant.used() == 0_B);
+    CHECK(process.used() == 6_KiB);
+}
+
+TEST_CASE("budget leases") {
+    digital::budget quota(10_KiB);
+    {
+        auto lease = quota.make_lease(4_KiB);
+        CHECK(lease.try_reserve(100_B));
+        CHECK(quota.used() == 4_KiB);
+        CHECK(lease.reserve() == 3996_B);
+        CHECK(lease.try_reserve(3996_B));
+        CHECK(lease.reserve() == 0_B);
+        CHECK(lease.try_reserve(5_KiB));
+        CHECK(quota.used() == 9_KiB);
+        // a chunk no longer fits, the exact shortfall does
+        CHECK(lease.try_reserve(1_KiB));
+        CHECK(quota.used() == 10_KiB);
+        CHECK_FALSE(lease.try_reserve(1_B));
+
+        lease.release(10_KiB);
+        CHECK(lease.reserve() == 4_KiB);
+        CHECK(quota.used() == 4_KiB);
+
+        auto moved = std::move(lease);
+        CHECK(moved.reserve() == 4_KiB);
+    }
+    CHECK(quota.used() == 0_B);
+}
+
+TEST_CASE("budget concurrent reservations never exceed the limit") {
+    digital::budget parent(1_MiB);
+    digital::budget child(512_KiB, &parent);
+    std::atomic<std::int64_t> granted{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([&, t] {
+            auto& target = t % 2 == 0 ? child : parent;
+            auto lease = target.make_lease(16_KiB);
+            for (int i = 0; i < 2000; ++i) {
+                if (lease.try_reserve(1_KiB)) {
+                    granted.fetch_add(1024);
+                }
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(granted.load() == 1024 * 1024);
+    CHECK(parent.used() == 1_MiB);
+    CHECK(child.used() <= 512_KiB);
+}
+
+TEST_CASE("budget failures under contention leave no charge behind") {
+    // the process level is the bottleneck, so reservations from both tenants get rolled back
+    digital::budget process(8_KiB);
+    digital::budget left(6_KiB, &process);
+    digital::budget right(6_KiB, &process);
+    std::atomic<std::int64_t> held{ 0 };
+    std::atomic<std::int64_t> peak{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([&, t] {
+            auto& target = t % 2 == 0 ? left : right;
+            for (int i = 0; i < 5000; ++i) {
+                if (!target.try_reserve(3_KiB)) {
+                    continue;
+                }
+                const std::int64_t now = held.fetch_add(3072) + 3072;
+                std::int64_t seen = peak.load();
+                while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+                }
+                held.fetch_sub(3072);
+                target.release(3_KiB);
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // a reservation may fail while a sibling's partial charge is in flight, but limits always hold
+    // and every rolled back charge is gone once the contention ends
+    CHECK(peak.load() <= 8 * 1024);
+    CHECK(process.used() == 0_B);
+    CHECK(left.used() == 0_B);
+    CHECK(right.used() == 0_B);
+    CHECK(left.try_reserve(6_KiB));
+    CHECK(right.try_reserve(2_KiB));
+    CHECK_FALSE(right.try_reserve(1_B));
+}
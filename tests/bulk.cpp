@@ -0,0 +1,338 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/bulk.hpp>
+
+#include <doctest/doctest.h>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+std::vector<digital::bytes> sample_bytes() {
+    std::vector<digital::bytes> v;
+    for (std::int64_t i = -1100; i <= 1100; i += 7) {
+        v.push_back(digital::bytes(i));
+    }
+    v.push_back(digital::bytes(std::int64_t{ 1 } << 40));
+    v.push_back(digital::bytes(-(std::int64_t{ 1 } << 40) - 1));
+    v.push_back(digital::bytes::max());
+    v.push_back(digital::bytes::min());
+    return v;
+}
+
+template <typename TTo, typename TFrom>
+bool matches_scalar(const std::vector<TFrom>& in) {
+    using digital::detail::bulk::isa;
+    const isa levels[] = { isa::scalar, isa::sse2, isa::avx2, isa::avx512 };
+    for (const isa level : levels) {
+        if (level > digital::detail::bulk::detect_isa()) {
+            break;
+        }
+        std::vector<TTo> out(in.size());
+        digital::detail::bulk::cast(level, in.data(), in.data() + in.size(), out.data());
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            if (out[i].value() != digital::unit_cast<TTo>(in[i]).value()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("bulk unit_cast matches scalar unit_cast") {
+    const auto b = sample_bytes();
+    CHECK(matches_scalar<digital::bytes>(b));
+    CHECK(matches_scalar<digital::kibibytes>(b));
+    CHECK(matches_scalar<digital::mebibytes>(b));
+    CHECK(matches_scalar<digital::kilobytes>(b));
+
+    const std::vector<digital::kibibytes> kib = { 0_KiB, 1_KiB, -1_KiB, 3_KiB, 1000_KiB, -77_KiB, 5_KiB };
+    CHECK(matches_scalar<digital::bytes>(kib));
+    CHECK(matches_scalar<digital::kilobytes>(kib));
+
+    const std::vector<digital::kilobytes> kb = { 0_KB, 1_KB, -1_KB, 3_KB, 1000_KB, -77_KB, 5_KB, 9_KB, 2_KB };
+    CHECK(matches_scalar<digital::bytes>(kb));
+    CHECK(matches_scalar<digital::unit<std::int64_t, std::ratio<1, 5'000'000'000>>>(kb));
+
+    using ubytes = digital::unit<std::uint64_t>;
+    using ukibibytes = digital::unit<std::uint64_t, digital::kibi>;
+    const std::vector<ubytes> ub = { ubytes(0), ubytes(1), ubytes(1023), ubytes(1024), ubytes(~0ULL), ubytes(9) };
+    CHECK(matches_scalar<ukibibytes>(ub));
+
+    CHECK(matches_scalar<digital::unit<double, digital::kibi>>(b));
+
+    using dkibibytes = digital::unit<double, digital::kibi>;
+    std::vector<dkibibytes> dkib;
+    for (double x = -40.0; x <= 40.0; x += 0.37) {
+        dkib.push_back(dkibibytes(x));
+    }
+    dkib.push_back(dkibibytes(1e12));
+    dkib.push_back(dkibibytes(-3.5e12));
+    dkib.push_back(dkibibytes(0.25));
+    CHECK(matches_scalar<digital::bytes>(dkib));
+    CHECK(matches_scalar<digital::kilobytes>(dkib));
+    CHECK(matches_scalar<digital::kibibytes>(dkib));
+}
+
+TEST_CASE("bulk unit_cast") {
+    const digital::bytes in[] = { 1_KiB, 2_KiB, -3_KiB, 4095_B, -4095_B };
+    digital::kibibytes out[5];
+    CHECK(digital::unit_cast<digital::kibibytes>(std::begin(in), std::end(in), out) == std::end(out));
+    CHECK(out[0] == 1_KiB);
+    CHECK(out[1] == 2_KiB);
+    CHECK(out[2] == -3_KiB);
+    CHECK(out[3] == 3_KiB);
+    CHECK(out[4] == -3_KiB);
+
+#if defined(__cpp_lib_span)
+    std::vector<digital::mebibytes> mib(8, 1_MiB);
+    std::vector<digital::kibibytes> kib(10);
+    const auto written = digital::unit_cast<digital::kibibytes>(std::span(mib), std::span(kib));
+    CHECK(written.size() == 8);
+    CHECK(written.data() == kib.data());
+    CHECK(kib[7] == 1024_KiB);
+    std::vector<digital::kibibytes> shorter(7);
+    CHECK_THROWS_AS(
+        digital::unit_cast<digital::kibibytes>(std::span(mib), std::span(shorter)), std::invalid_argument
+    );
+#endif
+}
+
+namespace {
+std::vector<digital::bytes> pseudo_random_bytes(std::size_t n, std::int64_t range) {
+    std::vector<digital::bytes> v;
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (std::size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        v.push_back(digital::bytes(static_cast<std::int64_t>(state >> 1) % range));
+    }
+    return v;
+}
+} // namespace
+
+TEST_CASE("bulk unit_cast divides by non-power-of-two factors exactly") {
+    using digital::detail::bulk::cast_op;
+    using digital::detail::bulk::cast_traits;
+    static_assert(cast_traits<digital::bytes, digital::kilobytes>::op == cast_op::div);
+    static_assert(cast_traits<digital::kibibytes, digital::kilobytes>::op == cast_op::scalar);
+    using ubytes = digital::unit<std::uint64_t>;
+    static_assert(cast_traits<ubytes, digital::unit<std::uint64_t, digital::kilo>>::op == cast_op::scalar);
+
+    // the full range, and the values around multiples of each divisor where truncation changes
+    std::vector<digital::bytes> b = pseudo_random_bytes(4'096, digital::bytes::max().value());
+    for (const std::int64_t d : { std::int64_t{ 3 }, std::int64_t{ 1'000 }, std::int64_t{ 1'000'000'007 } }) {
+        for (std::int64_t k = 0; k < 50; ++k) {
+            const std::int64_t top = (std::numeric_limits<std::int64_t>::max() / d - k) * d;
+            for (const std::int64_t m : { k * d, (k + 1) * d - 1, top, top - 1 }) {
+                b.push_back(digital::bytes(m));
+                b.push_back(digital::bytes(-m));
+            }
+        }
+    }
+    b.push_back(digital::bytes::max());
+    b.push_back(digital::bytes::min());
+    b.push_back(digital::bytes::min() + 1_B);
+    for (auto& x : pseudo_random_bytes(1'024, digital::bytes::max().value())) {
+        b.push_back(-x);
+    }
+    CHECK(matches_scalar<digital::kilobytes>(b));
+    CHECK(matches_scalar<digital::megabytes>(b));
+    CHECK(matches_scalar<digital::gigabytes>(b));
+    CHECK(matches_scalar<digital::exabytes>(b));
+    CHECK(matches_scalar<digital::unit<std::int64_t, std::ratio<3>>>(b));
+    CHECK(matches_scalar<digital::unit<std::int64_t, std::ratio<1'000'000'007>>>(b));
+    CHECK(matches_scalar<digital::unit<std::int64_t, std::ratio<(std::int64_t{ 1 } << 62) + 1>>>(b));
+}
+
+TEST_CASE("bulk sum") {
+    using digital::detail::bulk::isa;
+    const auto v = pseudo_random_bytes(1001, 1'000'000'000'000);
+    std::int64_t expected = 0;
+    for (const auto& b : v) {
+        expected += b.value();
+    }
+    for (const isa level : { isa::scalar, isa::sse2, isa::avx2, isa::avx512 }) {
+        if (level > digital::detail::bulk::detect_isa()) {
+            break;
+        }
+        const auto res = digital::detail::bulk::sum<digital::bytes>(level, v.data(), v.data() + v.size());
+        CHECK(res.value.value() == expected);
+        CHECK_FALSE(res.overflow);
+
+        const auto kib = digital::detail::bulk::sum<digital::kibibytes>(level, v.data(), v.data() + v.size());
+        CHECK(kib.value.value() == expected / 1'024);
+        CHECK_FALSE(kib.overflow);
+
+        // wrap-arounds in individual lanes that cancel out are not an overflow
+        std::vector<digital::bytes> cancelling(64, digital::bytes::max());
+        for (std::size_t i = 0; i < cancelling.size(); i += 2) {
+            cancelling[i] = digital::bytes::min() + 1_B;
+        }
+        const auto cancelled = digital::detail::bulk::sum<digital::bytes>(
+            level, cancelling.data(), cancelling.data() + cancelling.size()
+        );
+        CHECK(cancelled.value == 0_B);
+        CHECK_FALSE(cancelled.overflow);
+
+        std::vector<digital::bytes> huge(17, digital::bytes::max() / 4);
+        CHECK(digital::detail::bulk::sum<digital::bytes>(level, huge.data(), huge.data() + huge.size()).overflow);
+        std::vector<digital::bytes> tiny(17, digital::bytes::min() / 4);
+        CHECK(digital::detail::bulk::sum<digital::bytes>(level, tiny.data(), tiny.data() + tiny.size()).overflow);
+    }
+
+    // elements are summed in their own unit and only the total is converted
+    const std::vector<digital::bytes> halves(1'000, 512_B);
+    const auto half = digital::sum<digital::kibibytes>(halves.data(), halves.data() + halves.size());
+    CHECK(half.value == 500_KiB);
+    CHECK_FALSE(half.overflow);
+
+    const std::vector<digital::exabytes> exa(10, 1_EB);
+    const auto exaBytes = digital::sum<digital::bytes>(exa.data(), exa.data() + exa.size());
+    CHECK(exaBytes.overflow);
+    CHECK_FALSE(digital::sum<digital::bytes>(exa.data(), exa.data() + 9).overflow);
+    CHECK(digital::sum<digital::bytes>(exa.data(), exa.data() + 9).value == 9_EB);
+
+    const auto narrow = digital::sum<digital::unit<std::int32_t>>(exa.data(), exa.data() + 1);
+    CHECK(narrow.overflow);
+    const digital::exabytes negative[] = { -1_EB, -1_EB };
+    CHECK(digital::sum<digital::bytes>(std::begin(negative), std::end(negative)).value == -2_EB);
+    CHECK(digital::sum<digital::unit<std::uint64_t>>(std::begin(negative), std::end(negative)).overflow);
+
+    // a total that only fits once converted, and element overflows that cancel out
+    const std::vector<digital::bytes> maxBytes(4, digital::bytes::max());
+    const auto kibTotal =
+        digital::sum<digital::kibibytes>(maxBytes.data(), maxBytes.data() + maxBytes.size());
+    CHECK_FALSE(kibTotal.overflow);
+    CHECK(kibTotal.value.value() == std::numeric_limits<std::int64_t>::max() / 256);
+
+    const digital::unit<double, digital::kibi> fractions[] = { digital::unit<double, digital::kibi>(0.5),
+                                                               digital::unit<double, digital::kibi>(0.75) };
+    const auto fromDouble = digital::sum<digital::kibibytes>(std::begin(fractions), std::end(fractions));
+    CHECK(fromDouble.value == 1_KiB);
+    CHECK_FALSE(fromDouble.overflow);
+    CHECK(digital::sum<digital::bytes>(std::begin(fractions), std::end(fractions)).value == 1'280_B);
+
+#if defined(__SIZEOF_INT128__)
+    const auto wideTotal = digital::sum<digital::wide_bytes>(exa.data(), exa.data() + exa.size());
+    CHECK_FALSE(wideTotal.overflow);
+    CHECK(wideTotal.value == 10_EB);
+    const digital::wide_exabytes wideExa[] = { digital::wide_exabytes(10) };
+    CHECK(digital::sum<digital::bytes>(std::begin(wideExa), std::end(wideExa)).overflow);
+
+    // totals converted into a coarser 128-bit unit, whose max overflows when brought to bytes
+    const digital::wide_bytes fiveExa[] = { digital::wide_bytes(5'000'000'000'000'000'000),
+                                            digital::wide_bytes(5'000'000'000'000'000'000) };
+    const auto coarse = digital::sum<digital::wide_exabytes>(std::begin(fiveExa), std::end(fiveExa));
+    CHECK_FALSE(coarse.overflow);
+    CHECK(coarse.value == digital::wide_exabytes(10));
+    const digital::wide_bytes negativeExa[] = { digital::wide_bytes(-1'500'000'000'000'000'000),
+                                                digital::wide_bytes(-1'000'000'000'000'000'000) };
+    const auto truncated =
+        digital::sum<digital::wide_exabytes>(std::begin(negativeExa), std::end(negativeExa));
+    CHECK_FALSE(truncated.overflow);
+    CHECK(truncated.value == digital::wide_exabytes(-2));
+
+    // wrapping past 128 bits in bytes still fits in exabytes: 2 * (2^127 - 1) B is 2 * maxExa + 1 EB
+    const auto maxExa = digital::unit_cast<digital::wide_exabytes>(digital::wide_bytes::max());
+    const digital::wide_bytes wrapping[] = { digital::wide_bytes::max(), digital::wide_bytes::max() };
+    const auto wrapped = digital::sum<digital::wide_exabytes>(std::begin(wrapping), std::end(wrapping));
+    CHECK_FALSE(wrapped.overflow);
+    CHECK(wrapped.value == maxExa * 2 + digital::wide_exabytes(1));
+    const digital::wide_bytes wrappingDown[] = { digital::wide_bytes::min(), digital::wide_bytes::min() };
+    const auto wrappedDown =
+        digital::sum<digital::wide_exabytes>(std::begin(wrappingDown), std::end(wrappingDown));
+    CHECK_FALSE(wrappedDown.overflow);
+    CHECK(wrappedDown.value == -(maxExa * 2 + digital::wide_exabytes(1)));
+    const digital::wide_bytes overflowing[] = { digital::wide_bytes::max(), digital::wide_bytes(1) };
+    CHECK(digital::sum<digital::wide_bytes>(std::begin(overflowing), std::end(overflowing)).overflow);
+    CHECK_FALSE(
+        digital::sum<digital::wide_kilobytes>(std::begin(overflowing), std::end(overflowing)).overflow
+    );
+    const digital::wide_exabytes hugeExa[] = { digital::wide_exabytes::max() };
+    CHECK(digital::sum<digital::wide_bytes>(std::begin(hugeExa), std::end(hugeExa)).overflow);
+    CHECK_FALSE(digital::sum<digital::wide_exabytes>(std::begin(hugeExa), std::end(hugeExa)).overflow);
+#endif
+
+    CHECK(digital::sum(v.data(), v.data()).value == 0_B);
+    CHECK(digital::sum(v.data(), v.data() + v.size()).value.value() == expected);
+
+    const digital::unit<std::uint64_t> unsignedValues[] = { digital::unit<std::uint64_t>(~0ULL),
+                                                            digital::unit<std::uint64_t>(1) };
+    CHECK(digital::sum(std::begin(unsignedValues), std::end(unsignedValues)).overflow);
+    CHECK_FALSE(digital::sum(std::begin(unsignedValues), std::begin(unsignedValues) + 1).overflow);
+
+    const digital::unit<double> doubles[] = { digital::unit<double>(1e100),
+                                              digital::unit<double>(1.0),
+                                              digital::unit<double>(-1e100) };
+    const auto compensated = digital::sum(std::begin(doubles), std::end(doubles));
+    CHECK(compensated.value.value() == doctest::Approx(1.0));
+    CHECK_FALSE(compensated.overflow);
+
+    const auto gib = digital::sum<digital::unit<double, digital::gibi>>(v.data(), v.data() + v.size());
+    CHECK(gib.value.value() == doctest::Approx(static_cast<double>(expected) / 1073741824.0));
+
+#if defined(__cpp_lib_span)
+    CHECK(digital::sum(std::span(v)).value.value() == expected);
+    CHECK(
+        digital::sum<digital::kibibytes>(std::span(v)).value ==
+        digital::sum<digital::kibibytes>(v.data(), v.data() + v.size()).value
+    );
+#endif
+}
+
+TEST_CASE("bulk min max") {
+    using digital::detail::bulk::isa;
+    auto v = pseudo_random_bytes(1003, 1'000'000);
+    v[517] = -5_MB;
+    v[518] = -5_MB;
+    v[901] = 3_TB;
+    for (const isa level : { isa::scalar, isa::avx2, isa::avx512 }) {
+        if (level > digital::detail::bulk::detect_isa()) {
+            break;
+        }
+        const auto [lo, hi] = digital::detail::bulk::minmax(level, v.data(), v.data() + v.size());
+        CHECK(lo == -5_MB);
+        CHECK(hi == 3_TB);
+    }
+    CHECK(digital::min_element(v.data(), v.data() + v.size()) == v.data() + 517);
+    CHECK(digital::max_element(v.data(), v.data() + v.size()) == v.data() + 901);
+    CHECK(digital::min_element(v.data(), v.data()) == v.data());
+    CHECK(digital::minmax(v.data(), v.data() + v.size()).first == -5_MB);
+    CHECK(digital::minmax(v.data(), v.data()).first == digital::bytes::max());
+
+    const digital::kilobytes kb[] = { 3_KB, 1_KB, 2_KB };
+    CHECK(digital::minmax(std::begin(kb), std::end(kb)).second == 3_KB);
+
+#if defined(__cpp_lib_span)
+    CHECK(digital::min_element(std::span(v)) == std::span(v).begin() + 517);
+    CHECK(digital::max_element(std::span(v)) == std::span(v).begin() + 901);
+    CHECK(digital::minmax(std::span(v)).second == 3_TB);
+#endif
+}
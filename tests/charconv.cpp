@@ -0,0 +1,325 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/charconv.hpp>
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+template <typename TUnit = digital::bytes>
+constexpr TUnit parse(std::string_view s, const digital::parse_options& options = {}) {
+    TUnit v = TUnit::min();
+    const auto res = digital::from_chars(s.data(), s.data() + s.size(), v, options);
+    if (res.ec != std::errc{} || res.ptr != s.data() + s.size()) {
+        return TUnit::min();
+    }
+    return v;
+}
+
+template <typename TUnit = digital::bytes>
+std::errc parse_error(std::string_view s, const digital::parse_options& options = {}) {
+    TUnit v{ 0 };
+    return digital::from_chars(s.data(), s.data() + s.size(), v, options).ec;
+}
+} // namespace
+
+TEST_CASE("from_chars integers") {
+    CHECK(parse("0") == 0_B);
+    CHECK(parse("512") == 512_B);
+    CHECK(parse("512B") == 512_B);
+    CHECK(parse("-512 B") == -512_B);
+    CHECK(parse("10MB") == 10_MB);
+    CHECK(parse("10 kB") == 10_KB);
+    CHECK(parse("10KB") == 10_KB);
+    CHECK(parse("10KiB") == 10_KiB);
+    CHECK(parse("10Ki") == 10_KiB);
+    CHECK(parse("512k") == 512_KB);
+    CHECK(parse("3 GiB") == 3_GiB);
+    CHECK(parse("4TiB") == 4_TiB);
+    CHECK(parse("5PB") == 5_PB);
+    CHECK(parse("7EiB") == 7_EiB);
+    CHECK(parse("9223372036854775807") == digital::bytes::max());
+    CHECK(parse("-9223372036854775808") == digital::bytes::min());
+    CHECK(parse("0000000000000000000000042") == 42_B);
+    using ubytes = digital::unit<std::uint64_t>;
+    CHECK(parse<ubytes>("18446744073709551615") == ubytes::max());
+    CHECK(parse<ubytes>("1844674407370955161.5 B").value() == 1'844'674'407'370'955'161ULL);
+}
+
+TEST_CASE("from_chars fractions") {
+    CHECK(parse("5.5 GiB") == 5'905'580'032_B);
+    CHECK(parse("0.25MB") == 250'000_B);
+    CHECK(parse("2.75TiB") == 3'023'656'976'384_B);
+    CHECK(parse("1.5KiB") == 1536_B);
+    CHECK(parse(".5KiB") == 512_B);
+    CHECK(parse("1.KiB") == 1_KiB);
+    CHECK(parse("-0.5KiB") == -512_B);
+    CHECK(parse("1.0009765625 KiB") == 1025_B);
+    CHECK(parse("1.1 B") == 1_B);
+    CHECK(parse("-1.9 B") == -1_B);
+    CHECK(parse("0.000000000000000000000001 EiB") == 0_B);
+    CHECK(parse("1.00000000000000000000000000 EiB") == 1_EiB);
+    CHECK(parse<digital::kibibytes>("1.5 MiB") == 1536_KiB);
+    CHECK(parse<digital::gibibytes>("1 GB") == 0_GiB);
+    CHECK(parse<digital::unit<double, digital::gibi>>("1.5 GiB").value() == doctest::Approx(1.5));
+    CHECK(parse<digital::unit<double, digital::kibi>>("-1 MB").value() == doctest::Approx(-976.5625));
+
+    // suffixes worth more than 2^64 units of the target must still compile and parse
+    using centibytes = digital::unit<std::int64_t, std::ratio<1, 100>>;
+    CHECK(parse<centibytes>("1.5 KiB").value() == 153'600);
+    CHECK(parse<centibytes>("0 EB").value() == 0);
+    CHECK(parse_error<centibytes>("1 EB") == std::errc::result_out_of_range);
+    CHECK(parse<digital::unit<double, std::ratio<1, 100>>>("1 EB").value() == doctest::Approx(1e20));
+}
+
+TEST_CASE("from_chars options") {
+    CHECK(parse("10 gib") == 10_GiB);
+    CHECK(parse("10mb") == 10_MB);
+    CHECK(parse("10 gib", { false, true, false }) == digital::bytes::min());
+    CHECK(parse("10 GiB", { false, false, false }) == digital::bytes::min());
+    CHECK(parse("10GiB", { false, false, false }) == 10_GiB);
+    CHECK(parse("512k", { true, true, true }) == 512_KiB);
+    CHECK(parse("512kB", { true, true, true }) == 512_KB);
+}
+
+TEST_CASE("from_chars errors") {
+    CHECK(parse_error("") == std::errc::invalid_argument);
+    CHECK(parse_error("-") == std::errc::invalid_argument);
+    CHECK(parse_error(".") == std::errc::invalid_argument);
+    CHECK(parse_error("GiB") == std::errc::invalid_argument);
+    CHECK(parse_error<digital::unit<std::uint64_t>>("-1") == std::errc::invalid_argument);
+    CHECK(parse_error("9223372036854775808") == std::errc::result_out_of_range);
+    CHECK(parse_error("-9223372036854775809") == std::errc::result_out_of_range);
+    CHECK(parse_error("8 EiB") == std::errc::result_out_of_range);
+    CHECK(parse_error("123456789012345678901") == std::errc::result_out_of_range);
+    CHECK(parse_error<digital::unit<std::int32_t>>("2GiB") == std::errc::result_out_of_range);
+    CHECK(parse_error<digital::unit<std::uint64_t>>("18446744073709551616") ==
+          std::errc::result_out_of_range);
+
+    // like std::from_chars, an out of range number is still consumed as a whole
+    const std::string_view big = "123456789012345678901 KiB, 5";
+    digital::bytes untouched = 7_B;
+    const auto outOfRange = digital::from_chars(big.data(), big.data() + big.size(), untouched);
+    CHECK(outOfRange.ec == std::errc::result_out_of_range);
+    CHECK(outOfRange.ptr == big.data() + 25);
+    CHECK(untouched == 7_B);
+
+    // a suffix letter followed by a digit is not a suffix
+    const std::string_view exponent = "5e3";
+    digital::bytes five;
+    const auto notExa = digital::from_chars(exponent.data(), exponent.data() + exponent.size(), five);
+    CHECK(notExa.ec == std::errc{});
+    CHECK(notExa.ptr == exponent.data() + 1);
+    CHECK(five == 5_B);
+
+    // nor is a bare lowercase "e", which reads as a truncated exponent
+    const std::string_view truncated = "5e";
+    const auto notBareExa = digital::from_chars(truncated.data(), truncated.data() + truncated.size(), five);
+    CHECK(notBareExa.ec == std::errc{});
+    CHECK(notBareExa.ptr == truncated.data() + 1);
+    CHECK(five == 5_B);
+    CHECK(parse("5 e") == digital::bytes::min());
+    CHECK(parse("5eB") == 5_EB);
+    CHECK(parse("5 eib") == 5_EiB);
+    CHECK(parse("5E") == 5_EB);
+    CHECK(parse("5E", { true, true, true }) == 5_EiB);
+
+    digital::bytes v = 7_B;
+    const std::string_view s = "12 parsecs";
+    const auto res = digital::from_chars(s.data(), s.data() + s.size(), v);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == s.data() + 2);
+    CHECK(v == 12_B);
+
+    CHECK(parse_error("abc") == std::errc::invalid_argument);
+    CHECK(parse("5 Bytes") == digital::bytes::min());
+    CHECK(parse("5 KiBi") == digital::bytes::min());
+    static_assert(parse("1.5 KiB") == 1536_B);
+}
+
+TEST_CASE("from_chars_lines") {
+    std::string input;
+    std::vector<digital::bytes> expected;
+    for (int i = 0; i < 100; ++i) {
+        input += std::to_string(i) + (i % 3 == 0 ? " KiB\n" : i % 3 == 1 ? "MB\r\n" : "\n");
+        expected.push_back(
+            i % 3 == 0   ? digital::kibibytes(i)
+            : i % 3 == 1 ? digital::unit_cast<digital::bytes>(digital::megabytes(i))
+                         : digital::bytes(i)
+        );
+        if (i % 10 == 0) {
+            input += "\n  \n";
+        }
+    }
+    input += "1.5 GiB";
+    expected.push_back(1536_MiB);
+
+    std::vector<digital::bytes> out(200);
+    const auto res = digital::from_chars_lines(input.data(), input.data() + input.size(), out.data(), out.size());
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == input.data() + input.size());
+    CHECK(res.count == expected.size());
+    out.resize(res.count);
+    CHECK(out == expected);
+
+    const auto full = digital::from_chars_lines(input.data(), input.data() + input.size(), out.data(), 5);
+    CHECK(full.count == 5);
+    CHECK(full.ec == std::errc{});
+    CHECK(std::string_view(full.ptr, 2) == "5\n");
+
+    const std::string bad = "1 KiB\n2 KiB\nfoo\n4 KiB\n";
+    const auto err = digital::from_chars_lines(bad.data(), bad.data() + bad.size(), out.data(), out.size());
+    CHECK(err.ec == std::errc::invalid_argument);
+    CHECK(err.count == 2);
+    CHECK(err.ptr == bad.data() + 12);
+
+    const std::string trailing = "1 KiB x\n";
+    CHECK(
+        digital::from_chars_lines(trailing.data(), trailing.data() + trailing.size(), out.data(), out.size()).ec ==
+        std::errc::invalid_argument
+    );
+}
+
+namespace {
+template <typename TUnit>
+std::string format(const TUnit& value, const digital::format_options& options = {}) {
+    char buf[128];
+    const auto res = digital::to_chars(buf, buf + sizeof(buf), value, options);
+    REQUIRE(res.ec == std::errc{});
+    return std::string(buf, res.ptr);
+}
+} // namespace
+
+TEST_CASE("to_chars in the unit's own suffix") {
+    CHECK(format(1536_B) == "1536 B");
+    CHECK(format(12_KiB) == "12 KiB");
+    CHECK(format(digital::gigabytes(-3)) == "-3 GB");
+    CHECK(format(digital::bytes::max()) == "9223372036854775807 B");
+    CHECK(format(digital::bytes::min()) == "-9223372036854775808 B");
+    CHECK(format(12_KiB, { digital::scaling::none, 2, false }) == "12.00KiB");
+    CHECK(format(digital::unit<double, std::mega>(1.25)) == "1.25 MB");
+    CHECK(format(digital::unit<double, std::mega>(1.0)) == "1 MB");
+}
+
+TEST_CASE("to_chars with automatic scaling") {
+    using bits = digital::unit<std::int64_t, std::ratio<1, 8>>;
+    const digital::format_options iec{ digital::scaling::iec };
+    const digital::format_options si{ digital::scaling::si };
+    CHECK(format(1536_B, iec) == "1.5 KiB");
+    CHECK(format(1536_B, si) == "1.54 KB");
+    CHECK(format(1023_B, iec) == "1023 B");
+    CHECK(format(1024_B, iec) == "1 KiB");
+    CHECK(format(999_B, si) == "999 B");
+    CHECK(format(1000_B, si) == "1 KB");
+    CHECK(format(0_B, iec) == "0 B");
+    CHECK(format(digital::bytes(-1536), iec) == "-1.5 KiB");
+    CHECK(format(digital::bytes(-1), { digital::scaling::iec, 0 }) == "-1 B");
+    CHECK(format(digital::bytes(1), { digital::scaling::si, 3 }) == "1.000 B");
+    CHECK(format(1048575_B, iec) == "1 MiB");
+    CHECK(format(1048575_B, { digital::scaling::iec, 3 }) == "1023.999 KiB");
+    CHECK(format(digital::bytes::max(), iec) == "8 EiB");
+    CHECK(format(digital::bytes::max(), si) == "9.22 EB");
+    CHECK(format(digital::unit<std::uint64_t, std::ratio<1>>(~0ULL), si) == "18.45 EB");
+    CHECK(format(digital::exbibytes(7), si) == "8.07 EB");
+    CHECK(format(digital::exbibytes(7), { digital::scaling::si, 0 }) == "8 EB");
+    CHECK(format(digital::gibibytes(3), { digital::scaling::si, 6 }) == "3.221225 GB");
+    CHECK(format(bits(12), iec) == "1.5 B");
+    CHECK(format(bits(13), { digital::scaling::iec, 3 }) == "1.625 B");
+    CHECK(format(bits(13), { digital::scaling::iec, 2 }) == "1.63 B");
+    CHECK(format(bits(13), { digital::scaling::iec, 1 }) == "1.6 B");
+    CHECK(format(bits(1), { digital::scaling::iec, 1 }) == "0.1 B");
+    CHECK(format(bits(4), { digital::scaling::iec, 0 }) == "1 B");
+    CHECK(format(digital::unit<double>(1536.0), iec) == "1.5 KiB");
+    CHECK(format(digital::unit<double>(-2.5e9), si) == "-2.5 GB");
+
+    // rounding up to a whole next unit moves to that unit
+    CHECK(format(digital::bytes(1'048'575), { digital::scaling::iec, 2 }) == "1.00 MiB");
+    CHECK(format(digital::bytes(1'048'063), { digital::scaling::iec, 2 }) == "1023.50 KiB");
+    CHECK(format(digital::bytes(999'999), { digital::scaling::si, 2 }) == "1.00 MB");
+    CHECK(format(digital::bytes(-999'999), { digital::scaling::si, 1 }) == "-1.0 MB");
+    CHECK(format(digital::bytes(1'023), { digital::scaling::iec, 0 }) == "1023 B");
+    CHECK(format(digital::kibibytes(1'048'575), { digital::scaling::iec, 1 }) == "1.0 GiB");
+    CHECK(format(digital::exbibytes(7), { digital::scaling::iec, 1 }) == "7.0 EiB");
+    CHECK(format(digital::unit<double>(1'048'575.0), { digital::scaling::iec, 2 }) == "1.00 MiB");
+    CHECK(format(digital::unit<double>(-999'999.0), si) == "-1 MB");
+    CHECK(format(digital::unit<double>(1'048'063.0), { digital::scaling::iec, 2 }) == "1023.50 KiB");
+
+    // ratios without a suffix are scaled as IEC
+    CHECK(format(digital::unit<int, std::ratio<3>>(1000)) == "2.93 KiB");
+
+    // auto-scaling with exhaustive powers
+    for (int i = 0; i < 63; ++i) {
+        const std::int64_t v = std::int64_t{ 1 } << i;
+        const std::string expected = std::to_string(v >> (i / 10 * 10)) + " " +
+                                     digital::detail::charconv::kSuffixNames[1][i / 10];
+        CHECK(format(digital::bytes(v), iec) == expected);
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST_CASE("to_chars of 128-bit units") {
+    const digital::format_options iec{ digital::scaling::iec };
+    const digital::format_options si{ digital::scaling::si };
+    const digital::wide_bytes zebi(digital::detail::int128_t{ 1 } << 70);
+    CHECK(format(zebi) == "1180591620717411303424 B");
+    CHECK(format(zebi, iec) == "1024 EiB");
+    CHECK(format(zebi, si) == "1180.59 EB");
+    CHECK(format(-zebi, { digital::scaling::iec, 1 }) == "-1024.0 EiB");
+    CHECK(format(digital::wide_bytes::max()) == "170141183460469231731687303715884105727 B");
+    CHECK(format(digital::wide_bytes::min()) == "-170141183460469231731687303715884105728 B");
+    CHECK(format(digital::wide_bytes::max(), si) == "170141183460469231731.69 EB");
+    CHECK(format(digital::wide_exabytes(5), iec) == "4.34 EiB");
+    CHECK(format(digital::wide_exabytes::max(), iec) == "147573952589676412927999999999999999999.13 EiB");
+    CHECK(format(digital::wide_kibibytes(1'048'575), { digital::scaling::iec, 1 }) == "1.0 GiB");
+    CHECK(format(digital::wide_bytes(1'536), iec) == "1.5 KiB");
+    using unsigned_wide_bytes = digital::unit<digital::detail::uint128_t>;
+    CHECK(format(unsigned_wide_bytes::max()) == "340282366920938463463374607431768211455 B");
+}
+#endif
+
+TEST_CASE("to_chars reports a short buffer") {
+    char buf[8];
+    CHECK(digital::to_chars(buf, buf + sizeof(buf), 1536_B).ec == std::errc{});
+    CHECK(digital::to_chars(buf, buf + 6, 1536_B).ec == std::errc{});
+    CHECK(digital::to_chars(buf, buf + 5, 1536_B).ec == std::errc::value_too_large);
+    CHECK(digital::to_chars(buf, buf + 5, 1536_B).ptr == buf + 5);
+    CHECK(digital::to_chars(buf, buf, 0_B).ec == std::errc::value_too_large);
+}
+
+TEST_CASE("to_chars round-trips through from_chars") {
+    for (std::int64_t v : { std::int64_t{ 0 }, std::int64_t{ 1 }, std::int64_t{ 1023 }, std::int64_t{ 123456789 } }) {
+        char buf[64];
+        const auto out = digital::to_chars(buf, buf + sizeof(buf), digital::bytes(v));
+        digital::bytes parsed;
+        CHECK(digital::from_chars(buf, out.ptr, parsed).ec == std::errc{});
+        CHECK(parsed == digital::bytes(v));
+    }
+}
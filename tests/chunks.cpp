@@ -0,0 +1,162 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/chunks.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+/// Whether the extents are contiguous, cover [0, total) and their offsets are multiples of `alignment`
+template <typename TRange>
+bool covers(const TRange& range, std::int64_t total, std::int64_t alignment) {
+    std::int64_t next = 0;
+    for (const auto& e : range) {
+        if (e.offset.value() != next || e.length.value() < 0) {
+            return false;
+        }
+        if (e.length.value() != 0 && e.offset.value() % alignment != 0) {
+            return false;
+        }
+        next += e.length.value();
+    }
+    return next == total;
+}
+} // namespace
+
+TEST_CASE("chunks") {
+    constexpr auto range = digital::chunks(10_KiB, 4_KiB);
+    static_assert(range.size() == 3);
+    static_assert(range[0] == digital::extent<digital::kibibytes>{ 0_KiB, 4_KiB });
+    static_assert(range[2] == digital::extent<digital::kibibytes>{ 8_KiB, 2_KiB });
+
+    const auto bytes = digital::chunks(digital::bytes(10'000), 1_KiB, 4_KiB);
+    CHECK(bytes.chunk_size() == 4_KiB);
+    REQUIRE(bytes.size() == 3);
+    CHECK(bytes[1].offset == 4_KiB);
+    CHECK(bytes[2].length == digital::bytes(10'000 - 8'192));
+    CHECK(covers(bytes, 10'000, 4'096));
+
+    const auto sectors = digital::chunks(digital::bytes(5'000), digital::bytes(1'000), digital::bytes(520));
+    CHECK(sectors.chunk_size() == digital::bytes(1'040));
+    CHECK(sectors.size() == 5);
+    CHECK(covers(sectors, 5'000, 520));
+
+    CHECK(digital::chunks(0_B, 4_KiB).empty());
+    CHECK(digital::chunks(1_MiB, 1_MiB).size() == 1);
+
+    const auto huge = digital::chunks(digital::bytes::max(), 1_GiB, 4_KiB);
+    CHECK(huge.size() == std::size_t{ 1 } << 33);
+    CHECK(huge[huge.size() - 1].length == digital::bytes((std::int64_t{ 1 } << 30) - 1));
+
+    CHECK_THROWS_AS((void)digital::chunks(-1_B, 4_KiB), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::chunks(1'024_KiB, 0_KiB), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::chunks(1'024_KiB, 4_KiB, -4_KiB), std::invalid_argument);
+}
+
+TEST_CASE("partition") {
+    constexpr auto range = digital::partition(10_KiB, 4);
+    static_assert(range.size() == 4);
+    static_assert(range[0] == digital::extent<digital::kibibytes>{ 0_KiB, 2_KiB });
+    static_assert(range[1] == digital::extent<digital::kibibytes>{ 2_KiB, 2_KiB });
+    static_assert(range[2] == digital::extent<digital::kibibytes>{ 4_KiB, 3_KiB });
+    static_assert(range[3] == digital::extent<digital::kibibytes>{ 7_KiB, 3_KiB });
+
+    const std::int64_t totals[] = { 0, 1, 4'095, 4'096, 4'097, 1'000'000, 123'456'789 };
+    const std::int64_t alignments[] = { 1, 512, 520, 4'096 };
+    for (const std::int64_t total : totals) {
+        for (const std::int64_t alignment : alignments) {
+            for (std::size_t workers = 1; workers <= 9; ++workers) {
+                const auto p = digital::partition(digital::bytes(total), workers, digital::bytes(alignment));
+                REQUIRE(p.size() == workers);
+                CHECK(covers(p, total, alignment));
+                const auto [shortest, longest] = std::minmax_element(
+                    p.begin(), p.end(), [](const auto& a, const auto& b) { return a.length < b.length; }
+                );
+                CHECK((*longest).length.value() - (*shortest).length.value() <= alignment);
+            }
+        }
+    }
+
+    const auto few = digital::partition(8_KiB, 4, 4_KiB);
+    CHECK(few[0] == digital::extent<digital::kibibytes>{ 0_KiB, 0_KiB });
+    CHECK(few[1].length == 0_KiB);
+    CHECK(few[2] == digital::extent<digital::kibibytes>{ 0_KiB, 4_KiB });
+    CHECK(few[3] == digital::extent<digital::kibibytes>{ 4_KiB, 4_KiB });
+
+    const auto max = digital::partition(digital::bytes::max(), 3, 4_KiB);
+    CHECK(covers(max, std::numeric_limits<std::int64_t>::max(), 4'096));
+
+    CHECK_THROWS_AS((void)digital::partition(1_MiB, 0), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::partition(-1_MiB, 2), std::invalid_argument);
+    CHECK_THROWS_AS((void)digital::partition(1'024_KiB, 2, 0_KiB), std::invalid_argument);
+}
+
+TEST_CASE("chunk ranges are random access") {
+    const auto range = digital::chunks(1'024_KiB, 100_KiB);
+    using iterator = decltype(range.begin());
+    static_assert(std::is_same_v<
+                  std::iterator_traits<iterator>::iterator_category,
+                  std::random_access_iterator_tag>);
+#if defined(__cpp_lib_ranges)
+    static_assert(std::random_access_iterator<iterator>);
+    static_assert(std::ranges::random_access_range<decltype(range)>);
+    static_assert(std::ranges::sized_range<decltype(range)>);
+#endif
+
+    CHECK(range.end() - range.begin() == 11);
+    CHECK(range.begin()[10] == range[10]);
+    CHECK(*(range.end() - 1) == range[10]);
+    CHECK(*(2 + range.begin()) == range[2]);
+    CHECK(range.begin() < range.end());
+
+    auto it = range.begin();
+    it += 5;
+    CHECK((*it).offset == 500_KiB);
+    --it;
+    CHECK((*it--).offset == 400_KiB);
+    CHECK((*it).offset == 300_KiB);
+
+    const std::vector<digital::extent<digital::kibibytes>> copied(range.begin(), range.end());
+    CHECK(copied.size() == range.size());
+    CHECK(copied.back() == digital::extent<digital::kibibytes>{ 1'000_KiB, 24_KiB });
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital_fwd.hpp>
+
+#include <doctest/doctest.h>
+
+#include <type_traits>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+
+namespace {
+// Only names the types; must compile without the full definition of `unit`.
+struct transfer {
+    digital::bytes* total;
+    const digital::kibibytes& chunk(const digital::mebibytes& window);
+};
+} // namespace
+
+TEST_CASE("forward declarations") {
+    static_assert(std::is_same_v<digital::unit<std::int64_t>, digital::bytes>);
+    static_assert(std::is_same_v<digital::unit<std::int64_t, std::ratio<1000>>, digital::kilobytes>);
+    static_assert(std::is_same_v<digital::unit<std::int64_t, std::ratio<1024>>, digital::kibibytes>);
+    static_assert(std::is_same_v<digital::exbi, std::ratio<1'152'921'504'606'846'976>>);
+    static_assert(std::is_same_v<digital::exa, std::exa>);
+
+    transfer t{nullptr};
+    CHECK(t.total == nullptr);
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital.hpp>
+
+#include <doctest/doctest.h>
+
+#include <type_traits>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::double_literals;
+
+TEST_CASE("double literals") {
+    static_assert(std::is_same_v<decltype(1.5_GiB), digital::unit<double, digital::gibi>>);
+    static_assert(std::is_same_v<decltype(0.5_KB), digital::unit<double, digital::kilo>>);
+    static_assert(std::is_same_v<decltype(2_GiB), digital::gibibytes>);
+    static_assert(std::is_same_v<decltype(0x10_B), digital::bytes>);
+
+    static_assert(1.5_GiB == 1'536_MiB);
+    static_assert(0.25_KiB == 256_B);
+    static_assert(2.5_EB == 2'500_PB);
+    static_assert(1'000_B == 1_KB);
+
+    CHECK((1.5_GiB).value() == 1.5);
+    CHECK(digital::unit_cast<digital::bytes>(0.75_MiB) == 786'432_B);
+    CHECK(digital::unit_cast<digital::bytes>(-0.5_KB) == -500_B);
+    CHECK(digital::unit_cast<digital::kibibytes>(1.9_KiB) == 1_KiB);
+}
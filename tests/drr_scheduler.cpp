@@ -0,0 +1,169 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/drr_scheduler.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+TEST_CASE("drr_scheduler round robin") {
+    digital::drr_scheduler<std::string> scheduler(1_KiB);
+    const auto a = scheduler.add_flow();
+    const auto b = scheduler.add_flow();
+    CHECK(scheduler.flows() == 2);
+    CHECK(scheduler.empty());
+    CHECK_FALSE(scheduler.dequeue().has_value());
+
+    scheduler.enqueue(a, "a1", 512_B);
+    scheduler.enqueue(a, "a2", 512_B);
+    scheduler.enqueue(a, "a3", 512_B);
+    scheduler.enqueue(b, "b1", 1_KiB);
+    scheduler.enqueue(b, "b2", 100_B);
+    CHECK(scheduler.size() == 5);
+
+    std::string order;
+    while (auto next = scheduler.dequeue()) {
+        order += next->value + " ";
+    }
+    CHECK(order == "a1 a2 b1 a3 b2 ");
+    CHECK(scheduler.empty());
+}
+
+TEST_CASE("drr_scheduler shares bandwidth by weight") {
+    digital::drr_scheduler<int> scheduler(1_KiB);
+    const auto light = scheduler.add_flow(1);
+    const auto heavy = scheduler.add_flow(3);
+    for (int i = 0; i < 1000; ++i) {
+        scheduler.enqueue(light, i, 256_B);
+        scheduler.enqueue(heavy, i, 1_KiB);
+    }
+
+    std::map<std::size_t, digital::bytes> sent;
+    digital::bytes total{};
+    while (total < 400_KiB) {
+        const auto next = scheduler.dequeue();
+        REQUIRE(next.has_value());
+        sent[next->flow] += next->size;
+        total += next->size;
+    }
+    CHECK(sent[light] == 100_KiB);
+    CHECK(sent[heavy] == 300_KiB);
+}
+
+TEST_CASE("drr_scheduler items larger than the quantum") {
+    digital::drr_scheduler<int> scheduler(1_KiB);
+    const auto big = scheduler.add_flow();
+    const auto small = scheduler.add_flow();
+    scheduler.enqueue(big, 1, 3_KiB);
+    for (int i = 0; i < 4; ++i) {
+        scheduler.enqueue(small, 10 + i, 1_KiB);
+    }
+    std::vector<int> order;
+    while (auto next = scheduler.dequeue()) {
+        order.push_back(next->value);
+    }
+    CHECK(order == std::vector<int>{ 10, 11, 1, 12, 13 });
+}
+
+TEST_CASE("drr_scheduler idle flows don't bank credit and new flows join") {
+    digital::drr_scheduler<int> scheduler(1_KiB);
+    const auto a = scheduler.add_flow();
+    scheduler.enqueue(a, 1, 100_B);
+    CHECK(scheduler.dequeue()->value == 1);
+    const auto b = scheduler.add_flow();
+    scheduler.enqueue(b, 2, 1_KiB);
+    scheduler.enqueue(a, 3, 1_KiB);
+    scheduler.enqueue(a, 4, 1_KiB);
+    const auto c = scheduler.add_flow();
+    scheduler.enqueue(c, 5, 1_KiB);
+    std::vector<int> order;
+    while (auto next = scheduler.dequeue()) {
+        order.push_back(next->value);
+    }
+    CHECK(order == std::vector<int>{ 2, 3, 5, 4 });
+}
+
+TEST_CASE("drr_scheduler single producer submission") {
+    digital::drr_scheduler<int> scheduler(4_KiB, 64);
+    const auto a = scheduler.add_flow();
+    const auto b = scheduler.add_flow();
+    constexpr int kItems = 10000;
+    std::thread producer([&] {
+        for (int i = 0; i < kItems; ++i) {
+            while (!scheduler.submit(i % 2 == 0 ? a : b, i, 1_KiB)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int received = 0;
+    long long sum = 0;
+    while (received < kItems) {
+        if (auto next = scheduler.dequeue()) {
+            ++received;
+            sum += next->value;
+        }
+    }
+    producer.join();
+    CHECK(sum == static_cast<long long>(kItems) * (kItems - 1) / 2);
+    CHECK(scheduler.empty());
+}
+
+TEST_CASE("drr_scheduler rejects settings that would never schedule") {
+    CHECK_THROWS_AS(digital::drr_scheduler<int>(0_B), std::invalid_argument);
+    CHECK_THROWS_AS(digital::drr_scheduler<int>(-1_KiB), std::invalid_argument);
+
+    digital::drr_scheduler<int> scheduler(1_KiB);
+    CHECK_THROWS_AS(scheduler.add_flow(0), std::invalid_argument);
+    CHECK(scheduler.flows() == 0);
+    CHECK_THROWS_AS(scheduler.submit(scheduler.add_flow(), 1, 1_B), std::logic_error);
+    CHECK(scheduler.empty());
+
+    // the quantum of a flow must fit the rep
+    digital::drr_scheduler<int> large(digital::bytes::max() / 4);
+    CHECK(large.add_flow(4) == 0);
+    CHECK_THROWS_AS(large.add_flow(5), std::invalid_argument);
+    digital::drr_scheduler<int, digital::unit<std::int32_t>> narrow(digital::unit<std::int32_t>(1'024));
+    CHECK_THROWS_AS(narrow.add_flow(3'000'000), std::invalid_argument);
+    CHECK(narrow.flows() == 0);
+}
+
+TEST_CASE("drr_scheduler rejects unknown flows") {
+    digital::drr_scheduler<int> scheduler(1_KiB, 4);
+    CHECK_THROWS_AS(scheduler.enqueue(0, 1, 1_B), std::out_of_range);
+    CHECK_THROWS_AS(scheduler.submit(0, 1, 1_B), std::out_of_range);
+    const auto a = scheduler.add_flow();
+    CHECK_THROWS_AS(scheduler.enqueue(a + 1, 1, 1_B), std::out_of_range);
+    CHECK_THROWS_AS(scheduler.submit(a + 1, 1, 1_B), std::out_of_range);
+    CHECK(scheduler.submit(a, 2, 1_B));
+    CHECK(scheduler.empty());
+    CHECK(scheduler.dequeue()->value == 2);
+}
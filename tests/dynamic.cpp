@@ -0,0 +1,193 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/dynamic.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+const digital::dynamic_scale kAllScales[] = {
+    digital::dynamic_scale::B,
+    digital::dynamic_scale::KB,
+    digital::dynamic_scale::MB,
+    digital::dynamic_scale::GB,
+    digital::dynamic_scale::TB,
+    digital::dynamic_scale::PB,
+    digital::dynamic_scale::EB,
+    digital::dynamic_scale::KiB,
+    digital::dynamic_scale::MiB,
+    digital::dynamic_scale::GiB,
+    digital::dynamic_scale::TiB,
+    digital::dynamic_scale::PiB,
+    digital::dynamic_scale::EiB,
+};
+
+/// The static `unit_cast` of `value` held in the unit of `scale`
+template <typename TTo>
+TTo reference(std::int64_t value, digital::dynamic_scale scale) {
+    switch (scale) {
+    case digital::dynamic_scale::B:
+        return digital::unit_cast<TTo>(digital::bytes(value));
+    case digital::dynamic_scale::KB:
+        return digital::unit_cast<TTo>(digital::kilobytes(value));
+    case digital::dynamic_scale::MB:
+        return digital::unit_cast<TTo>(digital::megabytes(value));
+    case digital::dynamic_scale::GB:
+        return digital::unit_cast<TTo>(digital::gigabytes(value));
+    case digital::dynamic_scale::TB:
+        return digital::unit_cast<TTo>(digital::terabytes(value));
+    case digital::dynamic_scale::PB:
+        return digital::unit_cast<TTo>(digital::petabytes(value));
+    case digital::dynamic_scale::EB:
+        return digital::unit_cast<TTo>(digital::exabytes(value));
+    case digital::dynamic_scale::KiB:
+        return digital::unit_cast<TTo>(digital::kibibytes(value));
+    case digital::dynamic_scale::MiB:
+        return digital::unit_cast<TTo>(digital::mebibytes(value));
+    case digital::dynamic_scale::GiB:
+        return digital::unit_cast<TTo>(digital::gibibytes(value));
+    case digital::dynamic_scale::TiB:
+        return digital::unit_cast<TTo>(digital::tebibytes(value));
+    case digital::dynamic_scale::PiB:
+        return digital::unit_cast<TTo>(digital::pebibytes(value));
+    case digital::dynamic_scale::EiB:
+        return digital::unit_cast<TTo>(digital::exbibytes(value));
+    default:
+        break;
+    }
+    return TTo{};
+}
+
+/// Whether converting to `TTo` matches `unit_cast` for every value whose size in bytes fits; `TTo` must
+/// not be finer than bytes
+template <typename TTo>
+bool matches_unit_cast(const std::vector<std::int64_t>& values) {
+    for (const auto scale : kAllScales) {
+        const auto multiplier = digital::detail::dynamic::kMultipliers[static_cast<std::size_t>(scale)];
+        for (const std::int64_t v : values) {
+            if (v > std::numeric_limits<std::int64_t>::max() / static_cast<std::int64_t>(multiplier) ||
+                v < std::numeric_limits<std::int64_t>::min() / static_cast<std::int64_t>(multiplier)) {
+                continue;
+            }
+            const TTo converted = digital::dynamic_unit(v, scale);
+            if (converted.value() != reference<TTo>(v, scale).value()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("dynamic_unit construction") {
+    constexpr digital::dynamic_unit empty;
+    static_assert(empty.value() == 0 && empty.scale() == digital::dynamic_scale::B);
+
+    constexpr digital::dynamic_unit fromStatic = 3_GiB;
+    static_assert(fromStatic.value() == 3 && fromStatic.scale() == digital::dynamic_scale::GiB);
+    static_assert(digital::dynamic_unit(5_KB).scale() == digital::dynamic_scale::KB);
+    static_assert(digital::dynamic_unit(digital::unit<int, digital::exbi>(1)).scale() ==
+                  digital::dynamic_scale::EiB);
+
+    static_assert(std::is_convertible_v<digital::mebibytes, digital::dynamic_unit>);
+    static_assert(!std::is_convertible_v<digital::unit<std::int64_t, std::ratio<3>>, digital::dynamic_unit>);
+    static_assert(!std::is_convertible_v<digital::unit<double, digital::kibi>, digital::dynamic_unit>);
+    static_assert(sizeof(digital::dynamic_unit) == 2 * sizeof(std::int64_t));
+}
+
+TEST_CASE("dynamic_unit conversion") {
+    constexpr digital::bytes b = digital::dynamic_unit(3, digital::dynamic_scale::KiB);
+    static_assert(b == 3'072_B);
+    constexpr digital::kibibytes kib = digital::dynamic_unit(2'047, digital::dynamic_scale::KB);
+    static_assert(kib.value() == 1'999);
+    constexpr digital::gigabytes gb = digital::dynamic_unit(-1'536, digital::dynamic_scale::MiB);
+    static_assert(gb.value() == -1);
+    constexpr digital::exbibytes eib = digital::dynamic_unit(7, digital::dynamic_scale::EB);
+    static_assert(eib.value() == 6);
+
+    const digital::unit<double, digital::gibi> gib =
+        digital::dynamic_unit(1'536, digital::dynamic_scale::MiB);
+    CHECK(gib.value() == 1.5);
+
+    const std::vector<std::int64_t> values = {
+        0,
+        1,
+        -1,
+        7,
+        999,
+        1'000,
+        1'023,
+        1'024,
+        -1'025,
+        123'456'789,
+        -987'654'321'012,
+        std::int64_t{ 1 } << 40,
+        std::numeric_limits<std::int64_t>::max(),
+        std::numeric_limits<std::int64_t>::min() + 1,
+    };
+    CHECK(matches_unit_cast<digital::bytes>(values));
+    CHECK(matches_unit_cast<digital::kilobytes>(values));
+    CHECK(matches_unit_cast<digital::kibibytes>(values));
+    CHECK(matches_unit_cast<digital::megabytes>(values));
+    CHECK(matches_unit_cast<digital::gibibytes>(values));
+    CHECK(matches_unit_cast<digital::terabytes>(values));
+    CHECK(matches_unit_cast<digital::exabytes>(values));
+    CHECK(matches_unit_cast<digital::exbibytes>(values));
+#if defined(__SIZEOF_INT128__)
+    // without a 128-bit type `unit_cast` itself overflows `value * 3` for the largest exabyte counts
+    CHECK(matches_unit_cast<digital::unit<std::int64_t, std::ratio<7, 3>>>(values));
+#endif
+
+    // sizes beyond 8 EiB still convert into a unit they fit in
+    const digital::exabytes big = digital::dynamic_unit(9'000'000, digital::dynamic_scale::TiB);
+    CHECK(big.value() == 9);
+    const digital::kibibytes fromMax =
+        digital::dynamic_unit(std::numeric_limits<std::int64_t>::max(), digital::dynamic_scale::KB);
+    CHECK(fromMax.value() == std::numeric_limits<std::int64_t>::max() / 1'024 * 1'000 +
+                                 std::numeric_limits<std::int64_t>::max() % 1'024 * 1'000 / 1'024);
+}
+
+TEST_CASE("dynamic_unit comparison") {
+    using dyn = digital::dynamic_unit;
+    using digital::dynamic_scale;
+    static_assert(dyn(1, dynamic_scale::KiB) == dyn(1'024, dynamic_scale::B));
+    static_assert(dyn(1, dynamic_scale::KiB) > dyn(1, dynamic_scale::KB));
+    static_assert(dyn(-1, dynamic_scale::KiB) < dyn(-1, dynamic_scale::KB));
+    static_assert(dyn(-1, dynamic_scale::EiB) < dyn(0, dynamic_scale::B));
+    static_assert(dyn(3, dynamic_scale::MB) != dyn(3, dynamic_scale::MiB));
+    static_assert(dyn(1'000, dynamic_scale::EB) > dyn(1, dynamic_scale::EB));
+    static_assert(dyn(8, dynamic_scale::EiB) > dyn(8'000, dynamic_scale::PiB));
+    static_assert(dyn(2, dynamic_scale::GB) <= dyn(2'000, dynamic_scale::MB));
+    static_assert(dyn(2, dynamic_scale::GB) >= 2_GB);
+    static_assert(-dyn(2, dynamic_scale::GB) == -2_GB);
+    CHECK(dyn(5_MiB) == 5'120_KiB);
+    CHECK(dyn(5_MiB) < 5'243'000_B);
+}
@@ -0,0 +1,59 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::exact_literals;
+
+TEST_CASE("exact literals") {
+    static_assert(std::is_same_v<decltype(1.5_GiB), digital::bytes>);
+    static_assert(std::is_same_v<decltype(2_GiB), digital::gibibytes>);
+    static_assert(std::is_same_v<decltype(0x10_KiB), digital::kibibytes>);
+    static_assert(std::is_same_v<decltype(1e3_B), digital::bytes>);
+
+    static_assert((1.5_GiB).value() == 1'610'612'736);
+    static_assert((0.25_MB).value() == 250'000);
+    static_assert((2.75_TiB).value() == 3'023'656'976'384);
+    static_assert((0.001_KB).value() == 1);
+    static_assert((0.0009765625_KiB).value() == 1);
+    static_assert((1.000'5_MB).value() == 1'000'500);
+    static_assert((1.5e3_KB).value() == 1'500'000);
+    static_assert((2e-3_MB).value() == 2'000);
+    static_assert((0.0_EiB).value() == 0);
+    static_assert((7.5_EiB).value() == 8'646'911'284'551'352'320);
+    static_assert((9.223372036854775807_EB).value() == std::numeric_limits<std::int64_t>::max());
+    static_assert(1.5_GiB == 1'536_MiB);
+    static_assert(-0.5_KiB == -512_B);
+    static_assert(1'024_B == 1_KiB);
+
+    CHECK((3.25_KiB).value() == 3'328);
+    CHECK(1.5_GiB + 512_MiB == 2_GiB);
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/fixed.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+using fx = digital::fixed<std::int64_t, 16>;
+using fx32 = digital::fixed<std::int32_t, 8>;
+using fixed_gibibytes = digital::unit<fx, digital::gibi>;
+using fixed_mebibytes = digital::unit<fx, digital::mebi>;
+using fixed_megabytes = digital::unit<fx, digital::mega>;
+using fixed_bytes = digital::unit<fx>;
+} // namespace
+
+TEST_CASE("fixed arithmetic") {
+    static_assert(fx(3).raw() == 3 << 16);
+    static_assert(fx(1.5).raw() == 3 << 15);
+    static_assert(fx(-0.25).raw() == -(1 << 14));
+    static_assert(fx(1.5) + fx(0.25) == fx(1.75));
+    static_assert(fx(1.5) - 2 == fx(-0.5));
+    static_assert(fx32(1.5) * fx32(-2) == fx32(-3));
+    static_assert(fx32(-1) / 3 == fx32::from_raw(-85));
+#if defined(__SIZEOF_INT128__)
+    static_assert(fx(1.5) * fx(1.5) == fx(2.25));
+    static_assert(fx(-1.5) * 3 == fx(-4.5));
+    static_assert(fx(3) / 4 == fx(0.75));
+    static_assert(fx(1) / 3 == fx::from_raw(21'845));
+    static_assert(fx(-1) / 3 == fx::from_raw(-21'845));
+#endif
+    static_assert(fx(0.5) < fx(0.75) && fx(1) >= 1 && fx(2) != fx(2.5));
+
+    static_assert(static_cast<int>(fx(2.75)) == 2);
+    static_assert(static_cast<int>(fx(-2.75)) == -2);
+    static_assert(static_cast<double>(fx(2.75)) == 2.75);
+    static_assert(fx(digital::fixed<std::int64_t, 4>(1.5)) == fx(1.5));
+    static_assert(digital::fixed<std::int64_t, 4>(fx::from_raw(-(1 << 16) - 1)).raw() == -16);
+
+    static_assert(std::is_same_v<std::common_type_t<fx, std::int64_t>, fx>);
+    static_assert(std::is_same_v<std::common_type_t<int, fx>, fx>);
+    static_assert(std::is_same_v<std::common_type_t<fx32, fx>, fx>);
+    static_assert(std::numeric_limits<fx>::max().raw() == std::numeric_limits<std::int64_t>::max());
+    static_assert(std::numeric_limits<fx>::epsilon().raw() == 1);
+
+    fx v = 1;
+    v += fx(0.5);
+    v += v + v + v;
+    ++v;
+    CHECK(v == fx(7));
+    CHECK(v-- == fx(7));
+    CHECK(v == fx(6));
+    CHECK(std::hash<fx>{}(v) == std::hash<std::int64_t>{}(6 << 16));
+}
+
+TEST_CASE("fixed units") {
+    constexpr fixed_gibibytes quota(fx(1.5));
+    static_assert(quota.value() == fx(1.5));
+    static_assert(quota == 1'536_MiB);
+    static_assert(quota > 1_GiB && quota < 2_GiB);
+    static_assert(quota + 512_MiB == 2_GiB);
+#if defined(__SIZEOF_INT128__)
+    static_assert((quota * fx(0.5)).value() == fx(0.75));
+    static_assert(quota / 3 == fixed_gibibytes(fx(0.5)));
+#endif
+    static_assert(std::is_same_v<decltype(quota + 1_MiB), fixed_mebibytes>);
+
+    // integral units convert implicitly where the ratio is harmonic, like integral reps
+    static_assert(std::is_convertible_v<digital::gibibytes, fixed_mebibytes>);
+    static_assert(!std::is_convertible_v<digital::mebibytes, fixed_gibibytes>);
+    static_assert(!std::is_convertible_v<fixed_gibibytes, digital::gibibytes>);
+    static_assert(!std::is_constructible_v<fixed_gibibytes, double>);
+
+    // unit_cast scales the raw value
+    static_assert(digital::unit_cast<fixed_mebibytes>(quota).value() == fx(1'536));
+    static_assert(digital::unit_cast<fixed_gibibytes>(768_MiB).value() == fx(0.75));
+    static_assert(digital::unit_cast<fixed_megabytes>(quota).value() == fx::from_raw(105'553'116));
+    static_assert(digital::unit_cast<fixed_gibibytes>(fixed_megabytes(fx(-1'000))).value() ==
+                  -fx::from_raw(61'035));
+    static_assert(digital::unit_cast<digital::unit<fx32, digital::kibi>>(1_MB).value() == fx32(976.5625));
+    // the scaling factors don't fit into 32 bits, only the result does
+    using fx32_bytes = digital::unit<fx32>;
+    using fx32_gigabytes = digital::unit<fx32, digital::giga>;
+    static_assert(digital::unit_cast<digital::unit<fx32, digital::gibi>>(fx32_gigabytes(fx32(5))).value() ==
+                  fx32::from_raw(1'192));
+    static_assert(digital::unit_cast<digital::unit<fx32, digital::exbi>>(fx32_bytes(fx32(1))).value() ==
+                  fx32(0));
+    static_assert(digital::unit_cast<fx32_bytes>(digital::unit<fx32, digital::kilo>(fx32(-3))).value() ==
+                  fx32(-3'000));
+    static_assert(digital::unit_cast<fixed_bytes>(quota).value() == fx(1'610'612'736));
+    static_assert(digital::unit_cast<digital::mebibytes>(fixed_gibibytes(fx(1.0009765625))) == 1'025_MiB);
+    static_assert(digital::unit_cast<digital::gibibytes>(quota) == 1_GiB);
+    static_assert(digital::unit_cast<digital::gibibytes>(-quota) == -1_GiB);
+    static_assert(digital::unit_cast<digital::unit<double, digital::gibi>>(quota).value() == 1.5);
+
+    // rounding to integral units
+    static_assert(digital::floor<digital::gibibytes>(quota) == 1_GiB);
+    static_assert(digital::ceil<digital::gibibytes>(quota) == 2_GiB);
+    static_assert(digital::round<digital::gibibytes>(quota) == 2_GiB);
+    static_assert(digital::round<digital::gibibytes>(fixed_gibibytes(fx(2.5))) == 2_GiB);
+    static_assert(digital::floor<digital::gibibytes>(-quota) == -2_GiB);
+    static_assert(digital::ceil<digital::gibibytes>(-quota) == -1_GiB);
+    static_assert(digital::round<digital::gigabytes>(quota) == 2_GB);
+    static_assert(digital::floor<digital::megabytes>(quota) == 1'610_MB);
+
+    fixed_gibibytes used = 1_GiB;
+    used += fixed_gibibytes(fx(0.25));
+    CHECK(used.value() == fx(1.25));
+    CHECK(digital::ceil<digital::mebibytes>(used) == 1'280_MiB);
+}
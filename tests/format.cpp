@@ -0,0 +1,170 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/format.hpp>
+
+#include <doctest/doctest.h>
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+namespace {
+template <typename TUnit>
+bool valid(std::string_view spec) {
+    digital::detail::formatting::spec parsed;
+    auto it = spec.begin();
+    return digital::detail::formatting::parse<std::is_floating_point_v<typename TUnit::rep>>(it, spec.end(), parsed) &&
+           it == spec.end();
+}
+
+template <typename TUnit>
+std::string write(std::string_view spec, const TUnit& value) {
+    digital::detail::formatting::spec parsed;
+    auto it = spec.begin();
+    REQUIRE(digital::detail::formatting::parse<std::is_floating_point_v<typename TUnit::rep>>(it, spec.end(), parsed));
+    std::string out;
+    digital::detail::formatting::format<std::runtime_error>(value, parsed, std::back_inserter(out));
+    return out;
+}
+} // namespace
+
+TEST_CASE("format spec validation") {
+    CHECK(valid<digital::bytes>(""));
+    CHECK(valid<digital::bytes>("raw"));
+    CHECK(valid<digital::bytes>(".2iB"));
+    CHECK(valid<digital::bytes>("#.3sB"));
+    CHECK(valid<digital::bytes>("MB"));
+    CHECK(valid<digital::bytes>("EiB"));
+    CHECK(valid<digital::unit<double>>(".3raw"));
+    CHECK_FALSE(valid<digital::bytes>(".2raw"));
+    CHECK_FALSE(valid<digital::bytes>("."));
+    CHECK_FALSE(valid<digital::bytes>(".65"));
+    CHECK_FALSE(valid<digital::bytes>("mb"));
+    CHECK_FALSE(valid<digital::bytes>("KIB"));
+    CHECK_FALSE(valid<digital::bytes>("ZB"));
+    CHECK_FALSE(valid<digital::bytes>("bytes"));
+    CHECK_FALSE(valid<digital::bytes>("0iB"));
+
+    CHECK(valid<digital::bytes>(">10"));
+    CHECK(valid<digital::bytes>("*^12.2iB"));
+    CHECK(valid<digital::bytes>("<#8MB"));
+    CHECK(valid<digital::bytes>("#>10"));
+    CHECK(valid<digital::bytes>("12raw"));
+    CHECK_FALSE(valid<digital::bytes>("010"));
+    CHECK_FALSE(valid<digital::bytes>("{>10"));
+    CHECK_FALSE(valid<digital::bytes>("<<<5"));
+    CHECK_FALSE(valid<digital::bytes>("99999999999"));
+}
+
+TEST_CASE("format spec followed by an align char") {
+    for (const std::string_view rest : {"}>", "}<br>", "}^x"}) {
+        digital::detail::formatting::spec parsed;
+        auto it = rest.begin();
+        CHECK(digital::detail::formatting::parse<false>(it, rest.end(), parsed));
+        CHECK(it == rest.begin());
+        CHECK(parsed.fill == ' ');
+        CHECK(parsed.align == '<');
+    }
+}
+
+TEST_CASE("format spec output") {
+    CHECK(write("", 1536_B) == "1536 B");
+    CHECK(write("raw", 1536_KiB) == "1536");
+    CHECK(write(".2iB", 1536_B) == "1.50 KiB");
+    CHECK(write("iB", 1536_B) == "1.5 KiB");
+    CHECK(write("#sB", 1536_B) == "1.54KB");
+    CHECK(write("KiB", 1536_B) == "1.5 KiB");
+    CHECK(write("B", 3_KiB) == "3072 B");
+    CHECK(write("KiB", 3_KiB) == "3 KiB");
+    CHECK(write(".1KiB", 3_KiB) == "3.0 KiB");
+    CHECK(write("MB", digital::gibibytes(-1)) == "-1073.74 MB");
+    CHECK(write(".0GB", 1_TB) == "1000 GB");
+    CHECK(write("MiB", 10_KiB) == "0.01 MiB");
+    CHECK(write(".3raw", digital::unit<double>(1.5)) == "1.500");
+    CHECK(write("raw", digital::unit<double>(1.5)) == "1.5");
+    CHECK(write("KB", digital::unit<double>(1500.0)) == "1.5 KB");
+
+    CHECK(write("10", 1536_B) == "1536 B    ");
+    CHECK(write(">10", 1536_B) == "    1536 B");
+    CHECK(write("*^11.2iB", 1536_B) == "*1.50 KiB**");
+    CHECK(write("->#8iB", 1536_B) == "--1.5KiB");
+    CHECK(write("3", 1536_B) == "1536 B");
+    CHECK(write(">6raw", 1536_KiB) == "  1536");
+
+#if defined(__SIZEOF_INT128__)
+    // 128-bit reps, whose integral part in a finer unit needs up to 192 bits
+    const digital::wide_bytes zebi(digital::detail::int128_t{ 1 } << 70);
+    CHECK(write("", zebi) == "1180591620717411303424 B");
+    CHECK(write("raw", -zebi) == "-1180591620717411303424");
+    CHECK(write("iB", zebi) == "1024 EiB");
+    CHECK(write("B", digital::wide_exabytes::max()) ==
+          "170141183460469231731687303715884105727000000000000000000 B");
+    CHECK(write("raw", digital::wide_exabytes::min()) == "-170141183460469231731687303715884105728");
+#endif
+
+    // the buffer fits every digit of the largest floating-point values
+    using long_double_bytes = digital::unit<long double>;
+    const std::string huge = write(".2raw", long_double_bytes(std::numeric_limits<long double>::max()));
+    CHECK(huge.size() == std::numeric_limits<long double>::max_exponent10 + 4);
+    CHECK(write("EiB", digital::unit<double>(std::numeric_limits<double>::max())).size() > 290);
+}
+
+#if defined(PROX_DIGITAL_HAS_STD_FORMAT)
+TEST_CASE("std::format") {
+    CHECK(std::format("{}", 1536_B) == "1536 B");
+    CHECK(std::format("{:.2iB}", 1536_B) == "1.50 KiB");
+    CHECK(std::format("{:MB}|{:raw}", 2_GB, 7_KiB) == "2000 MB|7");
+    std::string out;
+    std::format_to(std::back_inserter(out), "[{:#iB}]", 3_MiB);
+    CHECK(out == "[3MiB]");
+    CHECK(std::format("[{:>10}]", 1_KiB) == "[     1 KiB]");
+    CHECK(std::format("[{:_^9.1iB}]", 1536_B) == "[_1.5 KiB_]");
+    CHECK(std::format("{}>", 1_KiB) == "1 KiB>");
+    CHECK(std::format("{}<br>", 1_KiB) == "1 KiB<br>");
+    CHECK(std::format("{}^x", 1_KiB) == "1 KiB^x");
+}
+#endif
+
+#if defined(PROX_DIGITAL_HAS_FMT)
+TEST_CASE("fmt::format") {
+    CHECK(fmt::format("{}", 1536_B) == "1536 B");
+    CHECK(fmt::format("{:.2iB}", 1536_B) == "1.50 KiB");
+    CHECK(fmt::format("{:MB}|{:raw}", 2_GB, 7_KiB) == "2000 MB|7");
+    fmt::memory_buffer out;
+    fmt::format_to(std::back_inserter(out), "[{:#iB}]", 3_MiB);
+    CHECK(fmt::to_string(out) == "[3MiB]");
+    CHECK(fmt::format("[{:>10}]", 1_KiB) == "[     1 KiB]");
+    CHECK(fmt::format("[{:_^9.1iB}]", 1536_B) == "[_1.5 KiB_]");
+    CHECK(fmt::format("{}>", 1_KiB) == "1 KiB>");
+    CHECK(fmt::format("{}<br>", 1_KiB) == "1 KiB<br>");
+    CHECK(fmt::format("{}^x", 1_KiB) == "1 KiB^x");
+    CHECK_THROWS_AS((void)fmt::format(fmt::runtime("{:XB}"), 1_B), fmt::format_error);
+}
+#endif
@@ -0,0 +1,130 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/granular.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+namespace {
+struct test_granularity {
+    static constexpr std::uint64_t default_bytes = 512;
+};
+
+using blocks = digital::granular_unit<test_granularity>;
+
+/// Restores the default granularity when a test is done with it
+struct granularity_guard {
+    ~granularity_guard() { blocks::set_granularity(digital::bytes(test_granularity::default_bytes)); }
+};
+
+std::vector<std::int64_t> sample() {
+    std::vector<std::int64_t> v;
+    for (std::int64_t i = -5'000; i <= 5'000; i += 13) {
+        v.push_back(i);
+    }
+    v.push_back(std::numeric_limits<std::int64_t>::max());
+    v.push_back(std::numeric_limits<std::int64_t>::min() + 1);
+    v.push_back(std::int64_t{ 1 } << 40);
+    v.push_back(-(std::int64_t{ 1 } << 40) - 7);
+    return v;
+}
+
+/// Whether the conversions from bytes agree with plain division for the current granularity
+bool matches_division() {
+    const std::int64_t g = blocks::granularity().value();
+    for (const std::int64_t n : sample()) {
+        const digital::bytes b(n);
+        const std::int64_t q = n / g;
+        const std::int64_t r = n % g;
+        if (digital::unit_cast<blocks>(b).value() != q) {
+            return false;
+        }
+        if (digital::floor<blocks>(b).value() != (r < 0 ? q - 1 : q)) {
+            return false;
+        }
+        if (digital::ceil<blocks>(b).value() != (r > 0 ? q + 1 : q)) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("granular_unit defaults") {
+    CHECK(digital::pages::granularity() == 4_KiB);
+    CHECK(digital::huge_pages::granularity() == 2_MiB);
+    CHECK(digital::fs_blocks::granularity() == 4_KiB);
+
+    CHECK(digital::unit_cast<digital::bytes>(digital::pages(3)) == 12_KiB);
+    CHECK(digital::unit_cast<digital::kibibytes>(digital::huge_pages(2)) == 4_MiB);
+    CHECK(digital::ceil<digital::pages>(1_B) == digital::pages(1));
+    CHECK(digital::ceil<digital::pages>(1_MiB) == digital::pages(256));
+    CHECK(digital::floor<digital::huge_pages>(3_MiB) == digital::huge_pages(1));
+    CHECK(digital::unit_cast<digital::fs_blocks>(1_GiB).value() == 262'144);
+}
+
+TEST_CASE("granular_unit conversions") {
+    const granularity_guard guard;
+    CHECK(matches_division());
+
+    const std::int64_t sizes[] = { 1, 3, 7, 520, 1'000, 4'096, 65'536, 1'000'003, std::int64_t{ 1 } << 33,
+        (std::int64_t{ 1 } << 62) + 1, std::numeric_limits<std::int64_t>::max() };
+    for (const std::int64_t size : sizes) {
+        blocks::set_granularity(digital::bytes(size));
+        CHECK(blocks::granularity().value() == size);
+        CHECK(matches_division());
+    }
+
+    blocks::set_granularity(520_B);
+    CHECK(digital::unit_cast<digital::bytes>(blocks(3)) == 1'560_B);
+    CHECK(digital::ceil<blocks>(1_KiB) == blocks(2));
+    CHECK(digital::unit_cast<blocks>(digital::unit<std::int32_t, digital::kibi>(-1)) == blocks(-1));
+
+    CHECK_THROWS_AS(blocks::set_granularity(0_B), std::invalid_argument);
+    CHECK_THROWS_AS(blocks::set_granularity(-4_KiB), std::invalid_argument);
+    CHECK(blocks::granularity() == 520_B);
+}
+
+TEST_CASE("granular_unit arithmetic") {
+    constexpr digital::pages a(3);
+    constexpr digital::pages b(5);
+    static_assert(a + b == digital::pages(8));
+    static_assert(b - a == digital::pages(2));
+    static_assert(a * 2 == digital::pages(6));
+    static_assert(2 * a == digital::pages(6));
+    static_assert(-a == digital::pages(-3));
+    static_assert(a < b && a <= b && b > a && b >= a && a != b);
+    static_assert(digital::pages::zero().value() == 0);
+    static_assert(!std::is_convertible_v<digital::pages, digital::fs_blocks>);
+    static_assert(!std::is_convertible_v<std::int64_t, digital::pages>);
+}
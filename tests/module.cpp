@@ -0,0 +1,51 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+// Built only with -DBUILD_MODULE=ON: checks that `import prox.digital;` exposes the types, functions and
+// literals of the core header. Compiling is most of the test; `main` repeats the checks at runtime.
+
+// the comparison category types have to be visible where `operator<=>` is instantiated
+#include <compare>
+
+import prox.digital;
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+static_assert(1_KiB == 1'024_B);
+static_assert(1_KiB + 1_B == 1'025_B);
+static_assert(digital::unit_cast<digital::kibibytes>(1_MiB).value() == 1'024);
+static_assert(digital::ceil<digital::kibibytes>(digital::bytes(1)) == 1_KiB);
+static_assert(digital::floor<digital::mebibytes>(1'535_KiB) == 1_MiB);
+static_assert(digital::abs(-1_GiB) == 1_GiB);
+static_assert(1_MB < 1_MiB && 1_GB != 1_GiB);
+static_assert(2 * 1_TB / 2 == 1'000_GB);
+
+int main() {
+    const digital::bytes total = digital::unit_cast<digital::bytes>(2_KiB) + 600_B;
+    bool ok = total.value() == 2'648;
+    ok = ok && digital::round<digital::kibibytes>(total) == 3_KiB;
+    ok = ok && digital::unit_cast<digital::bytes>(0.5_KiB) == 512_B;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/overflow.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+
+#if defined(PROX_DIGITAL_UNLIKELY) || defined(PROX_DIGITAL_HAS_OVERFLOW_BUILTINS)
+#error "overflow.hpp leaks its helper macros"
+#endif
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::unit_literals;
+
+TEST_CASE("overflow_unit within range") {
+    using checked_bytes = digital::checked_unit<digital::bytes>;
+    checked_bytes b = 1_KiB;
+    b += 1_B;
+    CHECK(b == 1025_B);
+    CHECK(b.get() == 1025_B);
+    CHECK(b + 1_KiB == 2049_B);
+    CHECK(1_KiB + b == 2049_B);
+    CHECK(b - 25_B == 1000_B);
+    CHECK(b * 2 == 2050_B);
+    CHECK(2 * b == 2050_B);
+    CHECK(b / 5 == 205_B);
+    CHECK(b % 1000 == 25_B);
+    CHECK(-b == -1025_B);
+    CHECK(b > 1_KiB);
+    CHECK(b++ == 1025_B);
+    CHECK(++b == 1027_B);
+    CHECK(b-- == 1027_B);
+    CHECK(--b == 1025_B);
+
+    const digital::bytes plain = b;
+    CHECK(plain == 1025_B);
+
+    static_assert(digital::saturating_unit<digital::bytes>(40_B) + 2_B == 42_B);
+}
+
+TEST_CASE("overflow_unit checked") {
+    using checked_bytes = digital::checked_unit<digital::bytes>;
+    CHECK_THROWS_AS(checked_bytes::max() + 1_B, std::overflow_error);
+    CHECK_THROWS_AS(checked_bytes::min() - 1_B, std::overflow_error);
+    CHECK_THROWS_AS(checked_bytes::max() * 2, std::overflow_error);
+    CHECK_THROWS_AS(checked_bytes::min() / -1, std::overflow_error);
+    CHECK_THROWS_AS(-checked_bytes::min(), std::overflow_error);
+    CHECK_THROWS_AS(checked_bytes(digital::exbibytes(8)), std::overflow_error);
+    CHECK_NOTHROW(checked_bytes(digital::exbibytes(7)));
+
+    checked_bytes b = checked_bytes::max();
+    CHECK_THROWS_AS(++b, std::overflow_error);
+}
+
+TEST_CASE("overflow_unit saturating") {
+    using saturating_bytes = digital::saturating_unit<digital::bytes>;
+    CHECK(saturating_bytes::max() + 1_B == digital::bytes::max());
+    CHECK(saturating_bytes::min() - 1_B == digital::bytes::min());
+    CHECK(saturating_bytes::min() + -1_B == digital::bytes::min());
+    CHECK(saturating_bytes::max() - -1_B == digital::bytes::max());
+    CHECK(saturating_bytes(2_EiB) * 4 == digital::bytes::max());
+    CHECK(saturating_bytes(2_EiB) * -8 == digital::bytes::min());
+    CHECK(saturating_bytes(-2_EiB) * -8 == digital::bytes::max());
+    CHECK(saturating_bytes::min() / -1 == digital::bytes::max());
+    CHECK(saturating_bytes(digital::exbibytes(8)) == digital::bytes::max());
+    CHECK(saturating_bytes(digital::exbibytes(-9)) == digital::bytes::min());
+
+    using saturating_ubytes = digital::saturating_unit<digital::unit<std::uint64_t>>;
+    CHECK(saturating_ubytes(1) - saturating_ubytes(2) == saturating_ubytes(0));
+    CHECK(saturating_ubytes::max() + saturating_ubytes(2) == saturating_ubytes::max());
+    CHECK(-saturating_ubytes(2) == saturating_ubytes(0));
+}
+
+TEST_CASE("overflow_unit wrapping") {
+    using wrapping_bytes = digital::wrapping_unit<digital::bytes>;
+    CHECK(wrapping_bytes::max() + 1_B == digital::bytes::min());
+    CHECK(wrapping_bytes::min() - 1_B == digital::bytes::max());
+    CHECK(wrapping_bytes::min() / -1 == digital::bytes::min());
+    CHECK(wrapping_bytes::min() % -1 == 0_B);
+}
+
+TEST_CASE("overflow_unit from a unit worth more than the representation") {
+    using checked_i32 = digital::checked_unit<digital::unit<std::int32_t>>;
+    using saturating_i32 = digital::saturating_unit<digital::unit<std::int32_t>>;
+    using wrapping_u32 = digital::wrapping_unit<digital::unit<std::uint32_t>>;
+    CHECK_THROWS_AS(checked_i32(digital::exbibytes(1)), std::overflow_error);
+    CHECK_THROWS_AS(checked_i32(digital::tebibytes(-1)), std::overflow_error);
+    CHECK(checked_i32(digital::exbibytes(0)) == digital::unit<std::int32_t>(0));
+    CHECK(saturating_i32(digital::tebibytes(3)).value() == std::numeric_limits<std::int32_t>::max());
+    CHECK(saturating_i32(digital::tebibytes(-3)).value() == std::numeric_limits<std::int32_t>::lowest());
+    CHECK(wrapping_u32(digital::unit<std::int64_t, digital::tera>(1)).value() == 3'567'587'328U);
+    CHECK(wrapping_u32(digital::unit<std::int64_t, digital::gibi>(1'000'000'000)).value() == 0U);
+}
@@ -0,0 +1,109 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/rate.hpp>
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+using namespace std::chrono_literals;
+
+TEST_CASE("rate from unit and duration") {
+    constexpr auto bandwidth = 100_MiB / 1s;
+    static_assert(std::is_same_v<decltype(bandwidth), const digital::mebibytes_per_second>);
+    static_assert(bandwidth.value() == 100);
+    static_assert(bandwidth.amount() == 100_MiB);
+
+    constexpr auto perMs = 5_KB / 2ms;
+    static_assert(std::is_same_v<decltype(perMs)::period, std::milli>);
+    CHECK(perMs.value() == 2);
+    CHECK(perMs == digital::kilobytes_per_second(2000));
+}
+
+TEST_CASE("rate conversions") {
+    const digital::mebibytes_per_second mibs(3);
+    const digital::bytes_per_second bps = mibs;
+    CHECK(bps.value() == 3 * 1024 * 1024);
+
+    const digital::rate<digital::bytes, std::milli> bytesPerMs1 = digital::kilobytes_per_second(3);
+    CHECK(bytesPerMs1.value() == 3);
+    CHECK(bytesPerMs1 == digital::kilobytes_per_second(3));
+    CHECK(mibs == digital::rate<digital::kibibytes, std::micro>(0) + digital::kibibytes_per_second(3072));
+
+    const digital::rate<digital::bytes, std::milli> bytesPerMs(1500);
+    CHECK(digital::rate_cast<digital::kilobytes_per_second>(bytesPerMs).value() == 1500);
+    CHECK(digital::rate_cast<digital::megabytes_per_second>(bytesPerMs).value() == 1);
+    CHECK(digital::rate_cast<digital::rate<digital::kibibytes>>(bytesPerMs).value() == 1464);
+
+    static_assert(std::is_convertible_v<digital::megabytes_per_second, digital::kilobytes_per_second>);
+    static_assert(!std::is_convertible_v<digital::kilobytes_per_second, digital::megabytes_per_second>);
+    using bytes_per_ms = digital::rate<digital::bytes, std::milli>;
+    static_assert(!std::is_convertible_v<digital::bytes_per_second, bytes_per_ms>);
+    static_assert(std::is_convertible_v<bytes_per_ms, digital::bytes_per_second>);
+}
+
+TEST_CASE("rate arithmetic") {
+    const auto total = 1_MiB / 1s + 512_KiB / 1s;
+    CHECK(total == 1536_KiB / 1s);
+    CHECK(1_MiB / 1s - 1_KiB / 1ms == 24_KiB / 1s);
+    CHECK(1_KB / 1ms > 999_KB / 1s);
+    CHECK(1_KB / 1ms <= 1_MB / 1s);
+    CHECK((2_MB / 1s) * 3 == 6_MB / 1s);
+    CHECK(3 * (2_MB / 1s) == 6_MB / 1s);
+    CHECK((6_MB / 1s) / 4 == 1_MB / 1s);
+
+    digital::bytes_per_second r(10);
+    r += digital::bytes_per_second(5);
+    r *= 2;
+    CHECK(r.value() == 30);
+    CHECK((-r).value() == -30);
+
+    using common = std::common_type_t<digital::kilobytes_per_second, digital::kibibytes_per_second>;
+    static_assert(std::is_same_v<common, digital::rate<digital::unit<std::int64_t, std::ratio<8>>>>);
+    CHECK(common(digital::kilobytes_per_second(1)).value() == 125);
+}
+
+TEST_CASE("rate with durations") {
+    constexpr auto transferred = (100_MiB / 1s) * 500ms;
+    static_assert(transferred == 50_MiB);
+    CHECK(digital::unit_cast<digital::bytes>(transferred) == 52428800_B);
+    CHECK(2s * (1_KB / 1ms) == 2_MB);
+    CHECK((3_KiB / 1ms) * 1min == 180000_KiB);
+
+    CHECK(1_GiB / (128_MiB / 1s) == 8s);
+    CHECK(std::chrono::round<std::chrono::milliseconds>(1_GiB / (100_MiB / 1s)) == 10'240ms);
+    CHECK(1_GiB / (1_MiB / 1ms) == 1024ms);
+    CHECK(1500_B / (1_KB / 1s) == 1500ms);
+    using milliseconds = std::chrono::duration<double, std::milli>;
+    static_assert(std::is_same_v<decltype(1_GiB / (1_MiB / 1ms)), milliseconds>);
+
+    // shorter than one period of the rate
+    CHECK(1_KiB / (1_MiB / 1s) == std::chrono::duration<double>(1.0 / 1024));
+    CHECK(std::chrono::ceil<std::chrono::microseconds>(1_KiB / (1_MiB / 1s)) == 977us);
+    CHECK(std::chrono::duration_cast<std::chrono::nanoseconds>(1_B / (1_GB / 1s)) == 1ns);
+    CHECK((0_B / (1_MiB / 1s)).count() == 0.0);
+}
@@ -0,0 +1,109 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/sharded_counter.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+
+TEST_CASE("sharded_counter basic operations") {
+    digital::sharded_counter<digital::bytes> counter(3);
+    CHECK(counter.shards() == 4);
+    CHECK(counter.read() == 0_B);
+
+    counter.add(1_KiB);
+    counter += 1_MB;
+    counter.sub(24_B);
+    counter -= 1_KB;
+    CHECK(counter.read() == 1000000_B);
+
+    CHECK(counter.drain() == 1000000_B);
+    CHECK(counter.read() == 0_B);
+
+    digital::sharded_counter<digital::kibibytes> kib;
+    CHECK(kib.shards() >= 1);
+    kib += 2_MiB;
+    CHECK(kib.read() == 2048_KiB);
+}
+
+TEST_CASE("sharded_counter concurrent updates") {
+    digital::sharded_counter<digital::bytes> counter(8);
+    constexpr int kThreads = 8;
+    constexpr int kIterations = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.push_back(std::thread([&counter] {
+            for (int i = 0; i < kIterations; ++i) {
+                counter += 3_B;
+                counter -= 1_B;
+            }
+        }));
+    }
+    digital::bytes drained{};
+    for (int i = 0; i < 100; ++i) {
+        drained += counter.drain();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    drained += counter.drain();
+    CHECK(drained == digital::bytes(2 * kThreads * kIterations));
+}
+
+TEST_CASE("sharded_counter reads while updates are in flight") {
+    digital::sharded_counter<digital::bytes> counter(8);
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 20000;
+    std::atomic<bool> start{ false };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.push_back(std::thread([&] {
+            while (!start.load()) {
+            }
+            for (int i = 0; i < kIterations; ++i) {
+                counter += 1_B;
+            }
+        }));
+    }
+    start.store(true);
+    // with only additions in flight, reads are monotonic and bounded by the final total
+    bool monotonic = true;
+    digital::bytes previous{};
+    for (int i = 0; i < 1000; ++i) {
+        const digital::bytes now = counter.read();
+        monotonic = monotonic && now >= previous && now <= digital::bytes(kThreads * kIterations);
+        previous = now;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(monotonic);
+    CHECK(counter.read() == digital::bytes(kThreads * kIterations));
+}
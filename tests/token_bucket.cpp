@@ -0,0 +1,168 @@
+/******************************************************************************
+MIT License
+
+Copyright (c) 2024 proxict
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*******************************************************************************/
+
+#include <prox/digital/token_bucket.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace digital = PROX_DIGITAL_NAMESPACE_NAME;
+using namespace digital::literals;
+using namespace std::chrono_literals;
+
+namespace {
+struct fake_clock {
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<fake_clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() { return time_point(current); }
+
+    static inline duration current{ 0 };
+};
+} // namespace
+
+TEST_CASE("token_bucket consumption and refill") {
+    fake_clock::current = 1s;
+    digital::token_bucket<fake_clock> bucket(1_MiB, 1_MiB / 1s);
+    CHECK(bucket.capacity() == 1_MiB);
+    CHECK(bucket.available() == 1_MiB);
+
+    CHECK(bucket.try_consume(512_KiB));
+    CHECK(bucket.available() == 512_KiB);
+    CHECK(bucket.try_consume(512_KiB));
+    CHECK(bucket.available() == 0_B);
+    CHECK_FALSE(bucket.try_consume(1_B));
+
+    // 1 MiB/s refills a byte in ~953.67ns
+    fake_clock::current += 953ns;
+    CHECK_FALSE(bucket.try_consume(1_B));
+    fake_clock::current += 1ns;
+    CHECK(bucket.try_consume(1_B));
+
+    fake_clock::current += 250ms;
+    CHECK(bucket.available() == 256_KiB);
+    CHECK_FALSE(bucket.try_consume(256_KiB + 1_B));
+    CHECK(bucket.try_consume(256_KiB));
+
+    // never refills past capacity
+    fake_clock::current += 10s;
+    CHECK(bucket.available() == 1_MiB);
+    CHECK_FALSE(bucket.try_consume(1_MiB + 1_B));
+    CHECK(bucket.try_consume(1_MiB));
+}
+
+TEST_CASE("token_bucket wait times and reservations") {
+    fake_clock::current = 0s;
+    digital::token_bucket<fake_clock> bucket(1_KB, 1_KB / 1ms, false);
+    CHECK(bucket.available() == 0_B);
+    CHECK(bucket.wait_time(500_B) == 500us);
+    CHECK(bucket.wait_time(2_KB) == 2ms);
+
+    fake_clock::current = 1ms;
+    CHECK(bucket.wait_time(1_KB) == 0ns);
+    CHECK(bucket.reserve(1_KB) == fake_clock::time_point(1ms));
+    // goes into debt: ready after 3 KB worth of refill
+    CHECK(bucket.reserve(3_KB) == fake_clock::time_point(4ms));
+    CHECK_FALSE(bucket.try_consume(1_B));
+    CHECK(bucket.wait_time(1_KB) == 4ms);
+
+    fake_clock::current = 4ms;
+    CHECK(bucket.available() == 0_B);
+    CHECK(bucket.try_consume(0_B));
+    fake_clock::current = 4500us;
+    CHECK(bucket.available() == 500_B);
+    fake_clock::current = 6ms;
+    CHECK(bucket.available() == 1_KB);
+}
+
+TEST_CASE("token_bucket rates that are not whole nanoseconds per byte") {
+    fake_clock::current = 0s;
+    digital::token_bucket<fake_clock> bucket(10_B, digital::rate<digital::bytes, std::ratio<3>>(1), false);
+    CHECK(bucket.wait_time(1_B) == 3s);
+    digital::token_bucket<fake_clock> fast(1_GB, 3_GB / 1s);
+    CHECK(fast.try_consume(1_GB));
+    CHECK(fast.wait_time(3_B) == 1ns);
+    CHECK(fast.wait_time(4_B) == 2ns);
+}
+
+TEST_CASE("token_bucket fractional and invalid rates") {
+    using double_rate = digital::rate<digital::unit<double>, std::ratio<1>>;
+    fake_clock::current = 0s;
+    digital::token_bucket<fake_clock> half(10_B, double_rate(0.5), false);
+    CHECK(half.wait_time(1_B) == 2s);
+    CHECK(half.wait_time(3_B) == 6s);
+    digital::token_bucket<fake_clock> third(10_B, double_rate(1.5), false);
+    // costs round up to the next 2^-32 ns per byte so that the rate is never exceeded
+    CHECK(third.wait_time(3_B) >= 2s);
+    CHECK(third.wait_time(3_B) <= 2s + 1ns);
+    using per_minute = digital::rate<digital::unit<double, digital::kilo>, std::ratio<60>>;
+    digital::token_bucket<fake_clock> slow(1_B, per_minute(1e-9), false);
+    CHECK(slow.wait_time(1_B) > std::chrono::hours(24 * 365));
+
+    using bucket = digital::token_bucket<fake_clock>;
+    using byte_rate = digital::rate<digital::bytes>;
+    CHECK_THROWS_AS(bucket(1_KiB, byte_rate(0)), std::invalid_argument);
+    CHECK_THROWS_AS(bucket(1_KiB, byte_rate(-1)), std::invalid_argument);
+    CHECK_THROWS_AS(bucket(1_KiB, double_rate(-0.5)), std::invalid_argument);
+    CHECK_THROWS_AS(bucket(1_KiB, double_rate(std::nan(""))), std::invalid_argument);
+}
+
+TEST_CASE("token_bucket never grants more than capacity plus refill") {
+    digital::token_bucket<> bucket(64_KiB, 1_MiB / 1s);
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<std::int64_t> granted{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([&] {
+            for (int i = 0; i < 20000; ++i) {
+                if (bucket.try_consume(1_KiB)) {
+                    granted.fetch_add(1024);
+                }
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto refill = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() * 1024 * 1024 / 1000000;
+    CHECK(granted.load() >= 64 * 1024);
+    CHECK(granted.load() <= 64 * 1024 + refill + 1024);
+}
+
+TEST_CASE("token_bucket consume blocks until allowed") {
+    digital::token_bucket<> bucket(1_KiB, 1_MiB / 1s, false);
+    const auto start = std::chrono::steady_clock::now();
+    bucket.consume(1_KiB);
+    CHECK(std::chrono::steady_clock::now() - start >= 976us);
+}
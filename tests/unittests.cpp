@@ -752,3 +752,169 @@ TEST_CASE("hash") {
     CHECK(std::hash<digital::kibibytes>{}(1_KiB) == std::hash<std::int64_t>{}(1));
     CHECK(std::hash<digital::kibibytes>{}(1_KiB) != std::hash<digital::bytes>{}(1024_B));
 }
+
+TEST_CASE("overflow-free unit_cast") {
+    CHECK(
+        digital::unit_cast<digital::kibibytes>(digital::kilobytes(8'000'000'000'000'000'000)).value() ==
+        7'812'500'000'000'000'000_i64
+    );
+    CHECK(
+        digital::unit_cast<digital::kibibytes>(digital::kilobytes(-8'000'000'000'000'000'001)).value() ==
+        -7'812'500'000'000'000'000_i64
+    );
+    CHECK(digital::unit_cast<digital::kibibytes>(1_KB).value() == 0_i64);
+    CHECK(digital::unit_cast<digital::kibibytes>(2047_KB).value() == 1999_i64);
+    CHECK(digital::unit_cast<digital::kibibytes>(-2047_KB).value() == -1999_i64);
+    CHECK(digital::unit_cast<digital::mebibytes>(digital::megabytes(9'000'000'000'000)).value() == 8'583'068'847'656_i64);
+
+    using weird = digital::unit<std::int64_t, std::ratio<3'000'000'000'000'000'000, 2'000'000'000'000'000'001>>;
+    CHECK(digital::unit_cast<digital::bytes>(weird(2'000'000'000)).value() == 2'999'999'999_i64);
+    CHECK(digital::unit_cast<digital::bytes>(weird(-2'000'000'000)).value() == -2'999'999'999_i64);
+    CHECK(digital::unit_cast<digital::exabytes>(digital::exbibytes(7)).value() == 8_i64);
+    CHECK(digital::unit_cast<digital::exabytes>(digital::exbibytes(-7)).value() == -8_i64);
+    CHECK(
+        digital::unit_cast<digital::exbibytes>(digital::exabytes::max()).value() == 7'999'999'999'999'999'999_i64
+    );
+    static_assert(digital::unit_cast<digital::exbibytes>(digital::exabytes(-9)).value() == -7);
+}
+
+TEST_CASE("overflow-free cross-ratio comparison") {
+    CHECK(10_EB > digital::bytes::max());
+    CHECK(digital::bytes::max() < 10_EB);
+    CHECK(digital::exbibytes(8) > digital::bytes::max());
+    CHECK(digital::exbibytes(-9) < digital::bytes::min());
+    CHECK(8_EiB != digital::bytes::min());
+    CHECK(digital::exbibytes::max() > digital::bytes::max());
+    CHECK(digital::exbibytes::min() < digital::bytes::min());
+    CHECK(digital::exabytes::max() < digital::exbibytes::max());
+    CHECK(1_EiB == 1'152'921'504'606'846'976_B);
+    CHECK(1_EB == 1'000'000'000'000'000'000_B);
+    CHECK(digital::kilobytes(8'000'000'000'000'000'000) == digital::kibibytes(7'812'500'000'000'000'000));
+    CHECK(digital::kilobytes(8'000'000'000'000'000'000) < digital::kibibytes(7'812'500'000'000'000'001));
+    CHECK(digital::kilobytes(-8'000'000'000'000'000'000) > digital::kibibytes(-7'812'500'000'000'000'001));
+    CHECK(digital::unit<std::uint64_t, digital::exa>(19) > digital::unit<std::uint64_t>(~0ULL));
+
+    static_assert(10_EB > digital::bytes::max());
+    static_assert(digital::exbibytes(-9) < digital::bytes::min());
+}
+
+TEST_CASE("literal parsing") {
+    static_assert(0x10_B == 16_B);
+    static_assert(0X1F_KiB == 31_KiB);
+    static_assert(0b1010_B == 10_B);
+    static_assert(0B11_MiB == 3_MiB);
+    static_assert(017_B == 15_B);
+    static_assert(00_B == 0_B);
+    static_assert(0xFF'FF_B == 65535_B);
+    static_assert(0b1111'0000_B == 240_B);
+    static_assert(1'000'000_B == 1_MB);
+    static_assert(9'223'372'036'854'775'807_B == digital::bytes::max());
+    static_assert(0x7FFF'FFFF'FFFF'FFFF_B == digital::bytes::max());
+    static_assert(8'589'934'591_GiB == digital::gibibytes(8'589'934'591));
+
+    CHECK((0xABCDEF_B).value() == 11'259'375_i64);
+    CHECK((0777_KB).value() == 511_i64);
+    CHECK((0b1'0000'0000_B).value() == 256_i64);
+}
+
+#if PROX_DIGITAL_HAS_CONCEPTS
+template <typename T>
+concept modulo_assignable = requires(T u, typename T::rep r) { u %= r; };
+#endif
+
+TEST_CASE("constraints") {
+    static_assert(std::is_constructible_v<digital::bytes, int>);
+    static_assert(!std::is_constructible_v<digital::bytes, double>);
+    static_assert(!std::is_convertible_v<int, digital::bytes>);
+    static_assert(std::is_convertible_v<digital::kibibytes, digital::bytes>);
+    static_assert(!std::is_convertible_v<digital::bytes, digital::kibibytes>);
+    static_assert(std::is_convertible_v<digital::bytes, digital::unit<double, digital::kibi>>);
+    static_assert(!std::is_convertible_v<digital::unit<double>, digital::bytes>);
+
+#if PROX_DIGITAL_HAS_CONCEPTS
+    static_assert(digital::any_unit<digital::bytes>);
+    static_assert(digital::any_unit<const digital::unit<float, digital::mebi>>);
+    static_assert(!digital::any_unit<std::int64_t>);
+    static_assert(!modulo_assignable<digital::unit<double>>);
+    static_assert(modulo_assignable<digital::bytes>);
+#endif
+}
+
+#if PROX_DIGITAL_HAS_CONCEPTS
+TEST_CASE("three-way comparison") {
+    static_assert((1_KiB <=> 1_KB) == std::strong_ordering::greater);
+    static_assert((1_KB <=> 1'000_B) == std::strong_ordering::equal);
+    static_assert((1_B <=> 1_EiB) == std::strong_ordering::less);
+    static_assert((10_EB <=> digital::bytes::max()) == std::strong_ordering::greater);
+
+    using fbytes = digital::unit<double>;
+    CHECK((fbytes(0.5) <=> 1_B) == std::partial_ordering::less);
+    CHECK((fbytes(1024.0) <=> 1_KiB) == std::partial_ordering::equivalent);
+    CHECK((fbytes(std::numeric_limits<double>::quiet_NaN()) <=> 1_B) == std::partial_ordering::unordered);
+
+    CHECK(1_KiB != 1_KB);
+    CHECK(1_MB >= 1_KB);
+}
+#endif
+
+#if defined(__SIZEOF_INT128__)
+TEST_CASE("128-bit reps") {
+    using wide = digital::detail::int128_t;
+    using uwide = digital::unit<digital::detail::uint128_t, digital::kibi>;
+    constexpr wide kExbibyte = wide{ 1 } << 60;
+
+    static_assert(digital::wide_bytes::max().value() > wide{ std::numeric_limits<std::int64_t>::max() });
+    static_assert(digital::wide_bytes::min().value() < wide{ std::numeric_limits<std::int64_t>::min() });
+    static_assert(uwide::max().value() > digital::detail::uint128_t{ std::numeric_limits<std::uint64_t>::max() });
+
+    // literals and 64-bit units convert implicitly
+    constexpr digital::wide_bytes total = 100'000_EiB;
+    static_assert(total.value() == kExbibyte * 100'000);
+    static_assert(total == 100'000_EiB);
+    static_assert(total > digital::bytes::max());
+    static_assert(total + 1_B > total);
+    static_assert(total - 1_B < 100'000_EiB);
+    static_assert(digital::wide_bytes(1_KiB) == 1'024_B);
+    static_assert(std::is_same_v<std::common_type_t<digital::wide_bytes, digital::kibibytes>, digital::wide_bytes>);
+
+    // casts, including the widening 64 -> 128 bit paths
+    static_assert(digital::unit_cast<digital::wide_exbibytes>(total).value() == 100'000);
+    static_assert(digital::unit_cast<digital::wide_kilobytes>(8_EiB).value() == kExbibyte * 8 / 1'000);
+    static_assert(digital::unit_cast<digital::wide_kibibytes>(digital::kilobytes::max()).value() ==
+                  wide{ std::numeric_limits<std::int64_t>::max() } * 125 / 128);
+    static_assert(digital::unit_cast<digital::wide_kibibytes>(-2047_KB).value() == -1999);
+    static_assert(digital::unit_cast<digital::wide_mebibytes>(digital::megabytes::min()).value() ==
+                  wide{ std::numeric_limits<std::int64_t>::min() } * 15'625 / 16'384);
+    static_assert(digital::unit_cast<digital::wide_bytes>(digital::exabytes::max()).value() ==
+                  wide{ std::numeric_limits<std::int64_t>::max() } * 1'000'000'000'000'000'000);
+    static_assert(digital::unit_cast<uwide>(digital::unit<std::uint64_t, digital::kilo>(~0ULL)).value() ==
+                  digital::detail::uint128_t{ ~0ULL } * 125 / 128);
+    static_assert(digital::unit_cast<digital::bytes>(digital::wide_kibibytes(3)) == 3'072_B);
+
+    // comparisons whose common unit does not fit 128 bits
+    using wide_exabytes = digital::wide_exabytes;
+    static_assert(digital::wide_bytes::max() < wide_exabytes::max());
+    static_assert(digital::wide_bytes::min() > wide_exabytes::min());
+    static_assert(total < wide_exabytes::max());
+    static_assert(total != wide_exabytes::max());
+    static_assert(wide_exabytes(5) == digital::wide_bytes(5'000'000'000'000'000'000));
+    static_assert(wide_exabytes(-5) < digital::wide_bytes(-4'999'999'999'999'999'999));
+    static_assert(digital::wide_kibibytes::max() > digital::wide_kilobytes::max());
+    static_assert(digital::wide_kibibytes::min() < digital::wide_kilobytes::min());
+    static_assert(uwide::max() > digital::unit<digital::detail::uint128_t>::max());
+    static_assert(uwide(4) == digital::unit<digital::detail::uint128_t>(4'096));
+
+    // rounding
+    static_assert(digital::floor<digital::wide_kibibytes>(1'535_B).value() == 1);
+    static_assert(digital::ceil<digital::wide_kibibytes>(1'025_B).value() == 2);
+    static_assert(digital::round<digital::wide_kibibytes>(1'536_B).value() == 2);
+    static_assert(digital::round<digital::wide_kibibytes>(2'560_B).value() == 2);
+    static_assert(digital::floor<digital::wide_exbibytes>(total + 1_KiB).value() == 100'000);
+    static_assert(digital::ceil<digital::wide_exbibytes>(total + 1_KiB).value() == 100'001);
+
+    CHECK(std::hash<digital::wide_bytes>{}(digital::wide_bytes(42)) == std::hash<digital::wide_bytes>{}(42_B));
+    CHECK(std::hash<digital::wide_bytes>{}(digital::wide_bytes(-1)) != std::hash<digital::wide_bytes>{}(1_B));
+    CHECK(std::hash<digital::wide_bytes>{}(total) != std::hash<digital::wide_bytes>{}(total + 1_B));
+    CHECK(std::hash<digital::wide_bytes>{}(total) != std::hash<digital::wide_bytes>{}(total * 2));
+}
+#endif